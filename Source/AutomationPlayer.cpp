@@ -0,0 +1,387 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - AutomationPlayer.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "AutomationPlayer.h"
+#include "MidiRouter.h"
+
+//==============================================================================
+// Event Sources
+
+struct AutomationPlayer::MidiFileSource : public AutomationPlayer::EventSource
+{
+    bool open(const juce::File& file) { return reader.open(file); }
+
+    bool readNext(MidiFileStreamReader::Event& event) override { return reader.readNext(event); }
+    void locate(double timeSeconds) override { reader.locate(timeSeconds); }
+
+    MidiFileStreamReader reader;
+};
+
+struct AutomationPlayer::RecordingSource : public AutomationPlayer::EventSource
+{
+    explicit RecordingSource(const MidiRouter& r) : router(r) {}
+
+    bool open(const juce::File& file)
+    {
+        if (!recording.open(file) || recording.getNumEvents() == 0)
+            return false;
+
+        chunk.reserve(4096);
+        locate(0.0);
+        return true;
+    }
+
+    bool readNext(MidiFileStreamReader::Event& event) override
+    {
+        for (;;)
+        {
+            // A fader move becomes two messages; hand them out one at a time
+            if (pendingIndex < numPending)
+            {
+                event = pending[(size_t) pendingIndex++];
+                return true;
+            }
+
+            if (chunkIndex < chunk.size())
+            {
+                const auto& recorded = chunk[chunkIndex++];
+
+                std::array<juce::MidiMessage, 2> messages;
+                int portIndex = 1;
+                float value = juce::jlimit(0.0f, 1.0f, (recorded.value + 0.5f) / 16383.0f);
+
+                numPending = router.createParameterMessages(recorded.paramIndex, value, messages, portIndex);
+                pendingIndex = 0;
+
+                for (int m = 0; m < numPending; ++m)
+                {
+                    auto& out = pending[(size_t) m];
+                    out.timeSeconds = (double) (recorded.timeMicros - recording.getStartTimeMicros()) / 1.0e6;
+                    out.portIndex = portIndex;
+                    out.numBytes = messages[(size_t) m].getRawDataSize();
+                    std::memcpy(out.data, messages[(size_t) m].getRawData(), (size_t) out.numBytes);
+                }
+
+                continue;
+            }
+
+            // Next chunk of the recording - only the blocks overlapping it are decoded
+            if (nextChunkMicros > recording.getEndTimeMicros())
+                return false;
+
+            if (!recording.readRange(nextChunkMicros, nextChunkMicros + chunkMicros, chunk))
+                return false;
+
+            chunkIndex = 0;
+            nextChunkMicros += chunkMicros;
+        }
+    }
+
+    void locate(double timeSeconds) override
+    {
+        nextChunkMicros = recording.getStartTimeMicros() + (juce::int64) (timeSeconds * 1.0e6);
+        chunk.clear();
+        chunkIndex = 0;
+        numPending = pendingIndex = 0;
+    }
+
+    static constexpr juce::int64 chunkMicros = 2000000;
+
+    const MidiRouter& router;
+    FlightRecording recording;
+    std::vector<FlightRecording::Event> chunk;
+    size_t chunkIndex = 0;
+    juce::int64 nextChunkMicros = 0;
+
+    std::array<MidiFileStreamReader::Event, 2> pending;
+    int numPending = 0;
+    int pendingIndex = 0;
+};
+
+//==============================================================================
+AutomationPlayer::AutomationPlayer(MidiRouter& router)
+    : juce::Thread("Cinemix Automation Player"),
+      midiRouter(router)
+{
+}
+
+AutomationPlayer::~AutomationPlayer()
+{
+    unload();
+}
+
+bool AutomationPlayer::loadFile(const juce::File& file)
+{
+    unload();
+
+    if (file.hasFileExtension("cmxrec"))
+    {
+        auto recordingSource = std::make_unique<RecordingSource>(midiRouter);
+        if (!recordingSource->open(file))
+            return false;
+
+        source = std::move(recordingSource);
+    }
+    else
+    {
+        auto midiFileSource = std::make_unique<MidiFileSource>();
+        if (!midiFileSource->open(file))
+            return false;
+
+        source = std::move(midiFileSource);
+    }
+
+    loadedFile = file;
+
+    // Anything still queued from a previous file is now stale
+    requestLocate(0.0);
+    startThread(juce::Thread::Priority::normal);
+    return true;
+}
+
+void AutomationPlayer::unload()
+{
+    stopThread(2000);
+    source.reset();
+    loadedFile = juce::File();
+    requestLocate(0.0);
+}
+
+void AutomationPlayer::setLoop(bool shouldLoop, double startSeconds, double endSeconds)
+{
+    loopStartSeconds = juce::jmax(0.0, startSeconds);
+    loopEndSeconds = juce::jmax(startSeconds, endSeconds);
+    loopEnabled = shouldLoop;
+}
+
+void AutomationPlayer::setVarispeed(double rate)
+{
+    varispeed = juce::jlimit(0.25, 4.0, rate);
+}
+
+void AutomationPlayer::locate(double fileSeconds)
+{
+    requestLocate(juce::jmax(0.0, fileSeconds));
+}
+
+void AutomationPlayer::requestLocate(double fileSeconds)
+{
+    // Position first, then the generation that publishes it
+    requestedLocateSeconds = fileSeconds;
+    requestedGeneration.fetch_add(1);
+}
+
+//==============================================================================
+// Loader Thread
+
+void AutomationPlayer::run()
+{
+    auto loadedGeneration = requestedGeneration.load() + 1;  // Forces an initial locate
+    double loopOffset = 0.0;
+    double segmentStart = 0.0;
+    int eventsSinceWrap = 0;
+    bool endOfFile = false;
+
+    while (!threadShouldExit())
+    {
+        auto generation = requestedGeneration.load();
+
+        if (generation != loadedGeneration)
+        {
+            segmentStart = requestedLocateSeconds.load();
+            source->locate(segmentStart);
+            loadedGeneration = generation;
+            loopOffset = 0.0;
+            eventsSinceWrap = 0;
+            endOfFile = false;
+        }
+
+        while (!endOfFile && fifo.getFreeSpace() > 0 && requestedGeneration.load() == loadedGeneration)
+        {
+            MidiFileStreamReader::Event event;
+            bool haveEvent = source->readNext(event);
+
+            // Wrap at the loop end (or at the end of the file, if the loop extends past it)
+            double loopStart = loopStartSeconds, loopEnd = loopEndSeconds;
+            bool canLoop = loopEnabled && loopEnd > loopStart && segmentStart < loopEnd;
+
+            if (canLoop && (!haveEvent || event.timeSeconds >= loopEnd))
+            {
+                if (eventsSinceWrap == 0 && segmentStart == loopStart)
+                {
+                    endOfFile = true;  // Nothing to play inside the loop
+                    break;
+                }
+
+                source->locate(loopStart);
+                loopOffset += loopEnd - loopStart;
+                segmentStart = loopStart;
+                eventsSinceWrap = 0;
+                continue;
+            }
+
+            if (!haveEvent)
+            {
+                endOfFile = true;
+                break;
+            }
+
+            // Checkpoints land before the locate target; skip up to it
+            if (event.timeSeconds < segmentStart)
+                continue;
+
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+            auto& queued = fifoEvents[(size_t) (size1 > 0 ? start1 : start2)];
+            queued.timeSeconds = event.timeSeconds + loopOffset;
+            queued.generation = loadedGeneration;
+            queued.portIndex = (juce::uint8) event.portIndex;
+            queued.numBytes = (juce::uint8) event.numBytes;
+            std::memcpy(queued.data, event.data, sizeof(queued.data));
+
+            fifo.finishedWrite(1);
+            ++eventsSinceWrap;
+        }
+
+        wait(10);
+    }
+}
+
+//==============================================================================
+// Audio Thread
+
+void AutomationPlayer::prepare(double sampleRate, int maximumBlockSize)
+{
+    currentSampleRate = sampleRate;
+    lineFreeAtSample.fill(0.0);
+
+    // Pacing caps each port at one message per two bytes of line time
+    auto maxMessagesPerBlock = (int) (maximumBlockSize * lineBytesPerSecond / (2.0 * sampleRate)) + 2;
+    for (auto& portBuffer : portBuffers)
+        portBuffer.ensureSize((size_t) maxMessagesPerBlock * 16);
+}
+
+void AutomationPlayer::processBlock(juce::AudioPlayHead* playHead, int numSamples)
+{
+    auto rate = varispeed.load();
+
+    juce::Optional<juce::AudioPlayHead::PositionInfo> position;
+    if (playHead != nullptr)
+        position = playHead->getPosition();
+
+    bool hostPlaying = enabled && isThreadRunning()
+                       && position.hasValue() && position->getIsPlaying()
+                       && position->getTimeInSeconds().hasValue();
+
+    if (hostPlaying)
+    {
+        auto hostSeconds = *position->getTimeInSeconds();
+
+        // Transport start or a jump in host time: follow it
+        if (!wasPlaying || std::abs(hostSeconds - expectedHostSeconds) > jumpToleranceSeconds)
+            requestLocate(hostSeconds * rate);
+
+        expectedHostSeconds = hostSeconds + numSamples / currentSampleRate;
+    }
+    else if (wasPlaying)
+    {
+        // The console no longer matches what the router last sent. The
+        // resend happens on the sending thread, which owns the router's cache
+        if (onPlaybackStopped != nullptr)
+            onPlaybackStopped();
+
+        lineFreeAtSample.fill(0.0);
+    }
+
+    wasPlaying = hostPlaying;
+
+    auto generation = requestedGeneration.load();
+    if (generation != playingGeneration)
+    {
+        playingGeneration = generation;
+        timelineSeconds = locatedSeconds = requestedLocateSeconds.load();
+    }
+
+    scheduleBlock(numSamples, hostPlaying ? rate : 0.0);
+
+    // Report the position in file time, unwinding any loop wraps the loader made
+    double loopStart = loopStartSeconds, loopEnd = loopEndSeconds;
+    double filePosition = timelineSeconds;
+
+    if (loopEnabled && loopEnd > loopStart && locatedSeconds < loopEnd && filePosition >= loopEnd)
+        filePosition = loopStart + std::fmod(filePosition - loopStart, loopEnd - loopStart);
+
+    positionSeconds = filePosition;
+}
+
+void AutomationPlayer::scheduleBlock(int numSamples, double rate)
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead(fifo.getNumReady(), start1, size1, start2, size2);
+
+    double blockStart = timelineSeconds;
+    double blockEnd = blockStart + numSamples / currentSampleRate * rate;
+    double samplesPerByte = currentSampleRate / lineBytesPerSecond;
+    int numConsumed = 0;
+
+    for (auto& portBuffer : portBuffers)
+        portBuffer.clear();
+
+    for (int n = 0; n < size1 + size2; ++n)
+    {
+        const auto& event = fifoEvents[(size_t) (n < size1 ? start1 + n : start2 + n - size1)];
+
+        // Left over from before a locate
+        if (event.generation != playingGeneration)
+        {
+            ++numConsumed;
+            continue;
+        }
+
+        // Stopped, or not due yet
+        if (rate <= 0.0 || event.timeSeconds >= blockEnd)
+            break;
+
+        auto port = (size_t) (event.portIndex == 2 ? 1 : 0);
+        double offset = juce::jmax(0.0, (event.timeSeconds - blockStart) / rate * currentSampleRate);
+
+        // Never put a message on the line before the previous one has left it
+        offset = juce::jmax(offset, lineFreeAtSample[port]);
+
+        if (offset >= numSamples)
+            break;  // Line saturated - the rest waits for the next block
+
+        portBuffers[port].addEvent(event.data, event.numBytes, (int) offset);
+        lineFreeAtSample[port] = offset + event.numBytes * samplesPerByte;
+        ++numConsumed;
+    }
+
+    fifo.finishedRead(numConsumed);
+
+    if (rate <= 0.0)
+        return;
+
+    for (auto& lineFree : lineFreeAtSample)
+        lineFree = juce::jmax(0.0, lineFree - numSamples);
+
+    timelineSeconds = blockEnd;
+
+    // Delivered one block late, so callback jitter never makes an event early or late
+    auto blockStartMs = juce::Time::getMillisecondCounterHiRes() + numSamples * 1000.0 / currentSampleRate;
+
+    for (size_t port = 0; port < portBuffers.size(); ++port)
+        if (!portBuffers[port].isEmpty())
+            midiRouter.sendMidiBuffer((int) port + 1, portBuffers[port], blockStartMs, currentSampleRate);
+}
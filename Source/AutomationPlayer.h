@@ -0,0 +1,162 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - AutomationPlayer.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "MidiFileStreamReader.h"
+#include "FlightRecording.h"
+
+class MidiRouter;
+
+//==============================================================================
+/**
+ * AutomationPlayer
+ *
+ * Plays a standard MIDI file or a FlightRecorder session (.cmxrec) to the
+ * console, locked to the host playhead.
+ *
+ * A loader thread streams the file from disk a few events at a time into a
+ * fixed-size lookahead FIFO; nothing is ever loaded whole. processBlock()
+ * takes the events that fall inside the current block, gives each one a
+ * sample offset and hands them to MidiRouter for timed delivery, so memory
+ * use stays flat however long the program is.
+ *
+ * - Locate: a host jump (or locate()) bumps a generation counter; the loader
+ *   seeks via the reader's checkpoint index and anything already queued for
+ *   the old position is dropped.
+ * - Loop: the loader wraps from the loop end back to the loop start itself,
+ *   so playback runs on without a gap.
+ * - Varispeed: scales how far file time advances per block, and where a
+ *   host jump lands (host time × rate). The file is read the same way at
+ *   any speed.
+ * - Pacing: each port is treated as a 31250 baud line, and messages that
+ *   would overlap on the wire are pushed later (into the next block if need
+ *   be) rather than bunched up.
+ */
+class AutomationPlayer : private juce::Thread
+{
+public:
+    //==============================================================================
+    explicit AutomationPlayer(MidiRouter& router);
+    ~AutomationPlayer() override;
+
+    /** Loads a .mid or .cmxrec file (message thread). Returns false if it can't be read. */
+    bool loadFile(const juce::File& file);
+
+    /** Stops the loader and forgets the current file */
+    void unload();
+
+    bool isLoaded() const { return source != nullptr; }
+    juce::File getLoadedFile() const { return loadedFile; }
+
+    /** Playback only happens while enabled and the host transport is running */
+    void setEnabled(bool shouldBeEnabled) { enabled = shouldBeEnabled; }
+    bool isEnabled() const { return enabled; }
+
+    /** Loops [startSeconds, endSeconds) of file time */
+    void setLoop(bool shouldLoop, double startSeconds, double endSeconds);
+
+    /**
+     * Playback speed relative to the host (0.25 - 4.0). File time is host
+     * time × rate: every transport start or host jump locates there. A rate
+     * changed mid-play takes effect from the current file position, and the
+     * two line up again at the next jump.
+     */
+    void setVarispeed(double rate);
+    double getVarispeed() const { return varispeed; }
+
+    /** Moves playback to a file position (any thread) */
+    void locate(double fileSeconds);
+
+    /** Current playback position in file time */
+    double getPositionSeconds() const { return positionSeconds; }
+
+    /**
+     * Called on the audio thread when the host stops during playback: the
+     * console then shows the file's values rather than the host's, and
+     * whoever sends parameters should send them all again.
+     */
+    std::function<void()> onPlaybackStopped;
+
+    //==============================================================================
+    void prepare(double sampleRate, int maximumBlockSize);
+
+    /** Schedules this block's events (audio thread) */
+    void processBlock(juce::AudioPlayHead* playHead, int numSamples);
+
+private:
+    //==============================================================================
+    struct PlaybackEvent
+    {
+        double timeSeconds;      // Timeline time: file time plus any completed loop lengths
+        juce::uint32 generation;
+        juce::uint8 portIndex;
+        juce::uint8 numBytes;
+        juce::uint8 data[3];
+    };
+
+    // Common interface over the two file formats
+    struct EventSource
+    {
+        virtual ~EventSource() = default;
+        virtual bool readNext(MidiFileStreamReader::Event& event) = 0;
+        virtual void locate(double timeSeconds) = 0;
+    };
+
+    struct MidiFileSource;
+    struct RecordingSource;
+
+    //==============================================================================
+    static constexpr int fifoSize = 8192;
+    static constexpr double lineBytesPerSecond = 3125.0;  // 31250 baud, 10 bits per byte
+    static constexpr double jumpToleranceSeconds = 0.01;
+
+    MidiRouter& midiRouter;
+    std::unique_ptr<EventSource> source;
+    juce::File loadedFile;
+
+    // Loader thread -> audio thread
+    juce::AbstractFifo fifo { fifoSize };
+    std::array<PlaybackEvent, fifoSize> fifoEvents;
+
+    // Locate requests: the audio thread only plays events of the latest generation
+    std::atomic<juce::uint32> requestedGeneration { 0 };
+    std::atomic<double> requestedLocateSeconds { 0.0 };
+
+    std::atomic<bool> enabled { false };
+    std::atomic<bool> loopEnabled { false };
+    std::atomic<double> loopStartSeconds { 0.0 };
+    std::atomic<double> loopEndSeconds { 0.0 };
+    std::atomic<double> varispeed { 1.0 };
+    std::atomic<double> positionSeconds { 0.0 };
+
+    // Audio thread state
+    double currentSampleRate = 44100.0;
+    juce::uint32 playingGeneration = 0;
+    double timelineSeconds = 0.0;
+    double locatedSeconds = 0.0;
+    double expectedHostSeconds = 0.0;
+    bool wasPlaying = false;
+    std::array<double, 2> lineFreeAtSample {};
+    std::array<juce::MidiBuffer, 2> portBuffers;
+
+    void run() override;
+    void requestLocate(double fileSeconds);
+    void scheduleBlock(int numSamples, double rate);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AutomationPlayer)
+};
@@ -0,0 +1,293 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeClient.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "BridgeClient.h"
+
+//==============================================================================
+BridgeClient::BridgeClient()
+    : juce::Thread("Cinemix Bridge Client")
+{
+    memory = BridgeSharedMemory::openForClient();
+
+    if (memory != nullptr && memory->isDaemonAlive())
+        claimSlot();
+
+    startThread(juce::Thread::Priority::high);
+}
+
+BridgeClient::~BridgeClient()
+{
+    stopThread(2000);
+
+    // Hand the slot back (unless the daemon already took it); the daemon
+    // keeps the console as it is
+    if (auto* claimed = slot.exchange(nullptr))
+    {
+        auto expected = (juce::uint32) BridgeSharedMemory::slotClaimed;
+
+        if (claimed->generation.load() == slotGeneration.load())
+            claimed->state.compare_exchange_strong(expected, BridgeSharedMemory::slotFree);
+    }
+}
+
+bool BridgeClient::isDaemonRunning()
+{
+    auto probe = BridgeSharedMemory::openForClient();
+    return probe != nullptr && probe->isDaemonAlive();
+}
+
+bool BridgeClient::isConnected() const noexcept
+{
+    return slot.load() != nullptr && memory->isDaemonAlive();
+}
+
+bool BridgeClient::claimSlot()
+{
+    auto& region = memory->getRegion();
+
+    for (auto& candidate : region.clients)
+    {
+        // Never touch the heartbeat of a slot another process holds: that
+        // would keep a crashed host's slot alive
+        if (candidate.state.load() != BridgeSharedMemory::slotFree)
+            continue;
+
+        // Heartbeat before claiming, so the daemon never sees the claim as stale
+        candidate.heartbeatMs = BridgeSharedMemory::now();
+
+        auto expected = (juce::uint32) BridgeSharedMemory::slotFree;
+        if (candidate.state.compare_exchange_strong(expected, BridgeSharedMemory::slotClaimed))
+        {
+            slotGeneration = candidate.generation.load();
+            daemonGeneration = region.header.daemonGeneration.load();
+            slot = &candidate;
+            return true;
+        }
+    }
+
+    return false;  // All slots in use
+}
+
+//==============================================================================
+// Clients
+
+void BridgeClient::addClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->addIfNotAlreadyThere(client);
+    clients.update(std::move(updated));
+}
+
+void BridgeClient::removeClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->removeFirstMatchingValue(client);
+    clients.update(std::move(updated));
+}
+
+//==============================================================================
+// Devices (owned by the daemon)
+
+juce::Array<juce::MidiDeviceInfo> BridgeClient::getAvailableInputs() const
+{
+    return {};
+}
+
+juce::Array<juce::MidiDeviceInfo> BridgeClient::getAvailableOutputs() const
+{
+    return {};
+}
+
+bool BridgeClient::openPorts(Client*, int, int, int, int)
+{
+    return areOutputsOpen();
+}
+
+void BridgeClient::releasePorts(Client*)
+{
+}
+
+bool BridgeClient::areOutputsOpen() const
+{
+    return isConnected() && memory->getRegion().header.outputsOpen.load() != 0;
+}
+
+juce::String BridgeClient::getPortStatusString() const
+{
+    if (!isConnected())
+        return "Bridge daemon not running";
+
+    const auto& header = memory->getRegion().header;
+    return "Bridge daemon\n" + juce::String::fromUTF8(header.portStatus, (int) strnlen(header.portStatus, sizeof(header.portStatus)));
+}
+
+bool BridgeClient::isConsoleLive() const
+{
+    return isConnected() && memory->getRegion().header.consoleLive.load() != 0;
+}
+
+void BridgeClient::setConsoleLive(bool isLive)
+{
+    BridgeEvent event;
+    event.type = BridgeEvent::consoleLive;
+    event.value = isLive ? 1 : 0;
+    push(event);
+}
+
+//==============================================================================
+// Output (any thread)
+
+void BridgeClient::push(const BridgeEvent& event) noexcept
+{
+    // Dropped while there's no daemon, or if it has fallen hopelessly behind
+    auto* claimed = slot.load();
+    if (claimed == nullptr)
+        return;
+
+    // Entered before the generation check, so the daemon can't rebuild the
+    // ring under this push if it reclaimed the slot while we were stalled
+    claimed->numUsers.fetch_add(1);
+
+    if (claimed->generation.load() == slotGeneration.load())
+        claimed->toDaemon.push(event);
+
+    claimed->numUsers.fetch_sub(1);
+}
+
+void BridgeClient::sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs)
+{
+    auto size = message.getRawDataSize();
+    if (portIndex < 1 || portIndex > 2 || size < 1 || size > 3)
+        return;
+
+    BridgeEvent event;
+    event.type = BridgeEvent::ordered;
+    event.portIndex = (juce::uint8) portIndex;
+    event.size = (juce::uint8) size;
+    std::memcpy(event.data, message.getRawData(), (size_t) size);
+
+    // Clocks aren't shared between processes, so due times travel as delays
+    if (dueTimeMs > 0.0)
+        event.delayMs = (float) juce::jmax(0.0, dueTimeMs - juce::Time::getMillisecondCounterHiRes());
+
+    push(event);
+}
+
+void BridgeClient::sendBlock(int portIndex, const juce::MidiBuffer& buffer,
+                             double startTimeMs, double sampleRate)
+{
+    if (sampleRate <= 0.0)
+        return;
+
+    for (const auto metadata : buffer)
+        sendOrdered(portIndex, metadata.getMessage(),
+                    startTimeMs + metadata.samplePosition * 1000.0 / sampleRate);
+}
+
+void BridgeClient::sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value)
+{
+    BridgeEvent event;
+    event.type = BridgeEvent::controller;
+    event.portIndex = (juce::uint8) portIndex;
+    event.data[0] = (juce::uint8) midiChannel;
+    event.data[1] = (juce::uint8) ccNumber;
+    event.value = (juce::uint16) (value & 0x7F);
+    push(event);
+}
+
+void BridgeClient::sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit)
+{
+    BridgeEvent event;
+    event.type = BridgeEvent::faderPair;
+    event.portIndex = (juce::uint8) portIndex;
+    event.data[0] = (juce::uint8) midiChannel;
+    event.data[1] = (juce::uint8) msbCcNumber;
+    event.data[2] = (juce::uint8) lsbCcNumber;
+    event.value = (juce::uint16) (value14Bit & 0x3FFF);
+    push(event);
+}
+
+//==============================================================================
+// Client Thread
+
+void BridgeClient::run()
+{
+    juce::int64 lastClaimAttemptMs = 0;
+
+    while (!threadShouldExit())
+    {
+        auto nowMs = BridgeSharedMemory::now();
+
+        if (memory == nullptr)
+        {
+            // No daemon had created the file yet when we started
+            if (nowMs - lastClaimAttemptMs > 500)
+            {
+                lastClaimAttemptMs = nowMs;
+                memory = BridgeSharedMemory::openForClient();
+            }
+        }
+        else if (auto* claimed = slot.load())
+        {
+            const auto& header = memory->getRegion().header;
+
+            if (header.daemonGeneration.load() != daemonGeneration || claimed->generation.load() != slotGeneration)
+            {
+                // The daemon restarted or gave our slot away (we were stalled): start again
+                slot = nullptr;
+            }
+            else
+            {
+                claimed->heartbeatMs = nowMs;
+
+                BridgeEvent event;
+                auto list = clients.read();
+
+                // Inside the slot while popping, as in push()
+                claimed->numUsers.fetch_add(1);
+
+                while (claimed->generation.load() == slotGeneration.load() && claimed->toClient.pop(event))
+                {
+                    if (event.type == BridgeEvent::reconnected)
+                    {
+                        for (auto* client : *list)
+                            client->consoleReconnected(event.value != 0);
+
+                        continue;
+                    }
+
+                    // Stamped with the daemon's arrival time, on this process's counter
+                    juce::MidiMessage message(event.data, (int) event.size,
+                                              event.timeMicros != 0 ? BridgeSharedMemory::fromEventTime(event.timeMicros) * 0.001 : 0.0);
+
+                    for (auto* client : *list)
+                        client->handleConsoleMessage(event.portIndex, message);
+                }
+
+                claimed->numUsers.fetch_sub(1);
+            }
+        }
+        else if (memory->isDaemonAlive() && nowMs - lastClaimAttemptMs > 500)
+        {
+            lastClaimAttemptMs = nowMs;
+            claimSlot();
+        }
+
+        wait(1);
+    }
+}
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeClient.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include "BridgeSharedMemory.h"
+#include "ConsoleTransport.h"
+#include "RcuPointer.h"
+
+//==============================================================================
+/**
+ * BridgeClient
+ *
+ * ConsoleTransport that talks to a bridge daemon (see BridgeDaemon) instead
+ * of opening the devices. One per process, shared by every MidiRouter
+ * through juce::SharedResourcePointer; it claims one client slot in the
+ * shared memory.
+ *
+ * Sending is a push into the slot's ring - no locks, no syscalls. A
+ * low-priority thread publishes this process's heartbeat, hands console
+ * input to the routers, and claims a new slot if the daemon restarts.
+ *
+ * The daemon owns device selection, so no devices are listed and
+ * openPorts() only reports whether the daemon has the console.
+ */
+class BridgeClient : public ConsoleTransport,
+                     private juce::Thread
+{
+public:
+    //==============================================================================
+    BridgeClient();
+    ~BridgeClient() override;
+
+    /** True if a bridge daemon is serving clients on this machine */
+    static bool isDaemonRunning();
+
+    /** True while this process holds a slot with a live daemon */
+    bool isConnected() const noexcept;
+
+    //==============================================================================
+    void addClient(Client* client) override;
+    void removeClient(Client* client) override;
+
+    juce::Array<juce::MidiDeviceInfo> getAvailableInputs() const override;
+    juce::Array<juce::MidiDeviceInfo> getAvailableOutputs() const override;
+
+    bool openPorts(Client* client, int inPort1Index, int inPort2Index,
+                   int outPort1Index, int outPort2Index) override;
+    void releasePorts(Client* client) override;
+    bool areOutputsOpen() const override;
+    juce::String getPortStatusString() const override;
+
+    bool isConsoleLive() const override;
+    void setConsoleLive(bool isLive) override;
+
+    //==============================================================================
+    void sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs = 0.0) override;
+    void sendBlock(int portIndex, const juce::MidiBuffer& buffer, double startTimeMs, double sampleRate) override;
+    void sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value) override;
+    void sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit) override;
+
+private:
+    //==============================================================================
+    std::unique_ptr<BridgeSharedMemory> memory;
+
+    std::atomic<BridgeSharedMemory::ClientSlot*> slot { nullptr };
+    std::atomic<juce::uint32> slotGeneration { 0 };     // Read by push() on any thread
+    juce::uint32 daemonGeneration = 0;
+
+    RcuPointer<juce::Array<Client*>> clients { std::make_unique<juce::Array<Client*>>() };
+    juce::CriticalSection clientLock;
+
+    bool claimSlot();
+    void push(const BridgeEvent& event) noexcept;
+
+    void run() override;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BridgeClient)
+};
@@ -0,0 +1,230 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeDaemon.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "BridgeDaemon.h"
+#include "BridgeClient.h"
+
+namespace
+{
+    /** Value of --name="value" (quotes optional), or an empty string */
+    juce::String getOption(const juce::StringArray& arguments, const juce::String& name)
+    {
+        for (const auto& argument : arguments)
+            if (argument.startsWith(name + "="))
+                return argument.fromFirstOccurrenceOf("=", false, false).unquoted();
+
+        return {};
+    }
+
+    template <typename DeviceList>
+    int findDevice(const DeviceList& devices, const juce::String& name)
+    {
+        if (name.isEmpty())
+            return -1;
+
+        for (int i = 0; i < devices.size(); ++i)
+            if (devices[i].name == name)
+                return i;
+
+        return -2;
+    }
+}
+
+//==============================================================================
+BridgeDaemon::BridgeDaemon()
+    : juce::Thread("Cinemix Bridge Daemon")
+{
+    hub->addClient(this);
+}
+
+BridgeDaemon::~BridgeDaemon()
+{
+    stopThread(2000);
+
+    // Tell clients straight away rather than after the heartbeat timeout
+    if (memory != nullptr)
+    {
+        memory->getRegion().header.magic = 0;
+        memory->getRegion().header.daemonHeartbeatMs = 0;
+    }
+
+    hub->releasePorts(this);
+    hub->removeClient(this);
+}
+
+bool BridgeDaemon::isDaemonCommandLine(const juce::String& commandLine)
+{
+    return juce::StringArray::fromTokens(commandLine, true).contains("--daemon");
+}
+
+bool BridgeDaemon::start(const juce::String& commandLine, juce::String& errorMessage)
+{
+    if (BridgeClient::isDaemonRunning())
+    {
+        errorMessage = "A bridge daemon is already running";
+        return false;
+    }
+
+    // Headless, so nothing to keep responsive: scan now, then pick by name
+    hub->refreshDevices();
+
+    auto arguments = juce::StringArray::fromTokens(commandLine, true);
+    auto inputDevices = hub->getAvailableInputs();
+    auto outputDevices = hub->getAvailableOutputs();
+
+    int in1 = findDevice(inputDevices, getOption(arguments, "--in1"));
+    int in2 = findDevice(inputDevices, getOption(arguments, "--in2"));
+    int out1 = findDevice(outputDevices, getOption(arguments, "--out1"));
+    int out2 = findDevice(outputDevices, getOption(arguments, "--out2"));
+
+    if (out1 < 0 || out2 < 0 || in1 == -2 || in2 == -2)
+    {
+        errorMessage = "Usage: --daemon --out1=<device> --out2=<device> [--in1=<device>] [--in2=<device>]";
+        return false;
+    }
+
+    memory = BridgeSharedMemory::openForDaemon(errorMessage);
+    if (memory == nullptr)
+        return false;
+
+    if (!hub->openPorts(this, in1, in2, out1, out2))
+    {
+        errorMessage = "Can't open the console ports";
+        return false;
+    }
+
+    // Everything clients read once is written before the magic number
+    auto& header = memory->getRegion().header;
+    hub->getPortStatusString().copyToUTF8(header.portStatus, sizeof(header.portStatus));
+    header.outputsOpen = hub->areOutputsOpen() ? 1 : 0;
+    header.daemonHeartbeatMs = BridgeSharedMemory::now();
+    header.magic = BridgeSharedMemory::magicNumber;
+
+    startThread(juce::Thread::Priority::high);
+    return true;
+}
+
+//==============================================================================
+// MIDI and Device Threads
+
+void BridgeDaemon::handleConsoleMessage(int portIndex, const juce::MidiMessage& message)
+{
+    auto size = message.getRawDataSize();
+    if (size < 1 || size > 3)
+        return;
+
+    BridgeEvent event;
+    event.type = BridgeEvent::consoleInput;
+    event.portIndex = (juce::uint8) portIndex;
+    event.size = (juce::uint8) size;
+    std::memcpy(event.data, message.getRawData(), (size_t) size);
+    event.timeMicros = BridgeSharedMemory::toEventTime(message.getTimeStamp() > 0.0 ? message.getTimeStamp() * 1000.0
+                                                                                   : juce::Time::getMillisecondCounterHiRes());
+    consoleInput.push(event);
+}
+
+void BridgeDaemon::consoleReconnected(bool needsFullResync)
+{
+    BridgeEvent event;
+    event.type = BridgeEvent::reconnected;
+    event.value = needsFullResync ? 1 : 0;
+    consoleInput.push(event);
+}
+
+//==============================================================================
+// Daemon Thread
+
+void BridgeDaemon::run()
+{
+    auto& region = memory->getRegion();
+
+    while (!threadShouldExit())
+    {
+        region.header.daemonHeartbeatMs = BridgeSharedMemory::now();
+        region.header.outputsOpen = hub->areOutputsOpen() ? 1 : 0;
+        region.header.consoleLive = hub->isConsoleLive() ? 1 : 0;
+
+        // Console -> every connected plugin process
+        BridgeEvent event;
+
+        while (consoleInput.pop(event))
+            for (auto& slot : region.clients)
+                if (slot.state.load() == BridgeSharedMemory::slotClaimed)
+                    slot.toClient.push(event);
+
+        // Plugins -> console (bounded, so one busy client can't starve the rest)
+        for (auto& slot : region.clients)
+        {
+            if (slot.state.load() != BridgeSharedMemory::slotClaimed)
+                continue;
+
+            for (int i = 0; i < 512 && slot.toDaemon.pop(event); ++i)
+                handleClientEvent(event);
+        }
+
+        reclaimStaleClients();
+        wait(1);
+    }
+}
+
+void BridgeDaemon::handleClientEvent(const BridgeEvent& event)
+{
+    switch (event.type)
+    {
+        case BridgeEvent::ordered:
+            if (event.size >= 1 && event.size <= 3)
+                hub->sendOrdered(event.portIndex, juce::MidiMessage(event.data, (int) event.size),
+                                 event.delayMs > 0.0f ? juce::Time::getMillisecondCounterHiRes() + event.delayMs : 0.0);
+            break;
+
+        case BridgeEvent::controller:
+            hub->sendControllerValue(event.portIndex, event.data[0], event.data[1], event.value);
+            break;
+
+        case BridgeEvent::faderPair:
+            hub->sendFaderValue(event.portIndex, event.data[0], event.data[1], event.data[2], event.value);
+            break;
+
+        case BridgeEvent::consoleLive:
+            hub->setConsoleLive(event.value != 0);
+            break;
+
+        case BridgeEvent::consoleInput:
+        case BridgeEvent::reconnected:
+        default:
+            break;
+    }
+}
+
+void BridgeDaemon::reclaimStaleClients()
+{
+    auto nowMs = BridgeSharedMemory::now();
+
+    for (auto& slot : memory->getRegion().clients)
+    {
+        auto state = slot.state.load();
+
+        // The host died (or hung): take the slot back, then free it once
+        // no thread of that host can still be inside its rings
+        if (state == BridgeSharedMemory::slotClaimed
+            && nowMs - slot.heartbeatMs.load() >= BridgeSharedMemory::heartbeatTimeoutMs)
+        {
+            BridgeSharedMemory::retireSlot(slot);
+            state = BridgeSharedMemory::slotReclaiming;
+        }
+
+        if (state == BridgeSharedMemory::slotReclaiming)
+            BridgeSharedMemory::tryFreeSlot(slot);
+    }
+}
@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeDaemon.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "BridgeSharedMemory.h"
+#include "MidiPortHub.h"
+
+//==============================================================================
+/**
+ * BridgeDaemon
+ *
+ * Headless mode of the Standalone app: owns the console ports and serves
+ * plugin instances in any number of hosts through BridgeSharedMemory.
+ *
+ *   CinemixAutomationBridge --daemon --out1="Port A" --out2="Port B"
+ *                           [--in1="Port A"] [--in2="Port B"]
+ *
+ * Plugin traffic is fed into the same MidiPortHub a single process would
+ * use, so pacing and coalescing apply across every host. Because the
+ * daemon keeps the ports open and remembers that the console has been
+ * initialised, a crashing DAW doesn't disturb the console: the restarted
+ * plugin reconnects and skips the initialisation sequence.
+ *
+ * Clients whose heartbeat stops are dropped after a timeout and their slot
+ * is reused. Device reconnects are passed on to every client, so each
+ * instance resends what it owns.
+ */
+class BridgeDaemon : private juce::Thread,
+                     private ConsoleTransport::Client
+{
+public:
+    //==============================================================================
+    BridgeDaemon();
+    ~BridgeDaemon() override;
+
+    /** True if the command line asks for daemon mode */
+    static bool isDaemonCommandLine(const juce::String& commandLine);
+
+    /** Opens the devices named on the command line and starts serving clients */
+    bool start(const juce::String& commandLine, juce::String& errorMessage);
+
+private:
+    //==============================================================================
+    juce::SharedResourcePointer<MidiPortHub> hub;
+    std::unique_ptr<BridgeSharedMemory> memory;
+
+    // Console input and reconnects from the MIDI and device threads, fanned out to clients by run()
+    MpscQueue<BridgeEvent, 1024> consoleInput;
+
+    void handleConsoleMessage(int portIndex, const juce::MidiMessage& message) override;
+    void consoleReconnected(bool needsFullResync) override;
+
+    void run() override;
+    void handleClientEvent(const BridgeEvent& event);
+    void reclaimStaleClients();
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BridgeDaemon)
+};
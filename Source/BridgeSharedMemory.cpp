@@ -0,0 +1,142 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeSharedMemory.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "BridgeSharedMemory.h"
+
+//==============================================================================
+juce::File BridgeSharedMemory::getSharedFile()
+{
+    return juce::File::getSpecialLocation(juce::File::tempDirectory)
+               .getChildFile("CinemixBridge.shm");
+}
+
+bool BridgeSharedMemory::map(const juce::File& file)
+{
+    mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readWrite, false);
+
+    if (mappedFile->getData() == nullptr || mappedFile->getSize() < sizeof(Region))
+        return false;
+
+    region = static_cast<Region*>(mappedFile->getData());
+    return true;
+}
+
+//==============================================================================
+std::unique_ptr<BridgeSharedMemory> BridgeSharedMemory::openForDaemon(juce::String& errorMessage)
+{
+    auto file = getSharedFile();
+
+    // Keep an existing file of the right size: connected clients have it
+    // mapped and will pick up the new daemon generation in place
+    if (file.getSize() != (juce::int64) sizeof(Region))
+    {
+        file.deleteFile();
+
+        juce::FileOutputStream stream(file);
+        if (stream.failedToOpen() || !stream.writeRepeatedByte(0, sizeof(Region)))
+        {
+            errorMessage = "Can't create " + file.getFullPathName();
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<BridgeSharedMemory> memory(new BridgeSharedMemory());
+    if (!memory->map(file))
+    {
+        errorMessage = "Can't map " + file.getFullPathName();
+        return nullptr;
+    }
+
+    // Lay the region out again; clients see magic == 0 until it's ready
+    auto& region = memory->getRegion();
+    auto generation = region.header.daemonGeneration.load() + 1;
+    bool sameLayout = region.header.version == layoutVersion;
+    region.header.magic = 0;
+
+    for (auto& slot : region.clients)
+    {
+        if (!sameLayout)
+        {
+            // A new file, or one left by another version: nothing of ours uses it
+            slot.~ClientSlot();
+            new (&slot) ClientSlot();
+            continue;
+        }
+
+        // Clients of the previous daemon may still be pushing, so their slots
+        // are retired rather than rebuilt under them; any still in use are
+        // freed by the daemon's thread later
+        retireSlot(slot);
+        tryFreeSlot(slot);
+    }
+
+    region.header.~Header();
+    new (&region.header) Header();
+    region.header.regionSize = (juce::uint32) sizeof(Region);
+    region.header.daemonGeneration = generation;
+    region.header.daemonHeartbeatMs = now();
+
+    return memory;
+}
+
+std::unique_ptr<BridgeSharedMemory> BridgeSharedMemory::openForClient()
+{
+    auto file = getSharedFile();
+
+    if (file.getSize() != (juce::int64) sizeof(Region))
+        return nullptr;
+
+    std::unique_ptr<BridgeSharedMemory> memory(new BridgeSharedMemory());
+    if (!memory->map(file))
+        return nullptr;
+
+    return memory;
+}
+
+void BridgeSharedMemory::retireSlot(ClientSlot& slot) noexcept
+{
+    // Generation first: a client entering from now on sees it and backs out
+    slot.generation = slot.generation.load() + 1;
+    slot.state = slotReclaiming;
+}
+
+bool BridgeSharedMemory::tryFreeSlot(ClientSlot& slot) noexcept
+{
+    // A client that entered before the generation changed is still inside
+    // (or died there, in which case the slot stays out of use)
+    if (slot.numUsers.load() != 0)
+        return false;
+
+    // Its rings may be half-written, so rebuild them before the slot is offered again
+    using ToDaemon = decltype(slot.toDaemon);
+    using ToClient = decltype(slot.toClient);
+
+    slot.toDaemon.~ToDaemon();
+    new (&slot.toDaemon) ToDaemon();
+    slot.toClient.~ToClient();
+    new (&slot.toClient) ToClient();
+
+    slot.state = slotFree;
+    return true;
+}
+
+bool BridgeSharedMemory::isDaemonAlive() const noexcept
+{
+    const auto& header = region->header;
+
+    return header.magic.load() == magicNumber
+        && header.version == layoutVersion
+        && header.regionSize == (juce::uint32) sizeof(Region)
+        && now() - header.daemonHeartbeatMs.load() < heartbeatTimeoutMs;
+}
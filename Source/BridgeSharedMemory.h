@@ -0,0 +1,174 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeSharedMemory.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "MpscQueue.h"
+
+//==============================================================================
+/**
+ * BridgeEvent
+ *
+ * One entry in a bridge ring: a console message or a transport command.
+ * Fixed size and trivially copyable, so it can live in shared memory.
+ */
+struct BridgeEvent
+{
+    enum Type : juce::uint8
+    {
+        ordered,        // Raw message (data/size), sent in order after delayMs
+        controller,     // Coalesced CC: data[0] = channel, data[1] = CC, value
+        faderPair,      // Coalesced fader: data[0] = channel, data[1] = MSB CC, data[2] = LSB CC, value
+        consoleLive,    // value = 1 after initialisation, 0 after reset
+        consoleInput,   // Daemon -> plugin: raw message from the console
+        reconnected     // Daemon -> plugin: a lost output came back, value = 1 if a full resync is needed
+    };
+
+    juce::uint8 type = ordered;
+    juce::uint8 portIndex = 1;
+    juce::uint8 size = 0;
+    juce::uint8 data[3] {};
+    juce::uint16 value = 0;
+    float delayMs = 0.0f;
+    juce::uint32 timeMicros = 0;    // consoleInput: arrival time (see BridgeSharedMemory::toEventTime), 0 = unknown
+};
+
+static_assert(sizeof(BridgeEvent) == 16, "BridgeEvent is part of the shared memory layout");
+
+//==============================================================================
+/**
+ * BridgeSharedMemory
+ *
+ * The memory-mapped file the bridge daemon and plugin instances share. Once
+ * it's mapped, everything goes through atomics and lock-free rings in the
+ * mapping itself - no syscalls on the fast path.
+ *
+ * Each plugin process claims one client slot with a pair of rings (the same
+ * MpscQueue used in-process; its atomics are address-free, so it works
+ * across processes too). The daemon and the clients each publish a
+ * wall-clock heartbeat so either side can tell when the other has gone.
+ */
+class BridgeSharedMemory
+{
+public:
+    //==============================================================================
+    static constexpr juce::uint32 magicNumber = 0x43784272;   // "CxBr"
+    static constexpr juce::uint32 layoutVersion = 3;
+    static constexpr int maxClients = 8;
+    static constexpr juce::int64 heartbeatTimeoutMs = 2000;
+
+    enum SlotState : juce::uint32
+    {
+        slotFree = 0,
+        slotClaimed = 1,
+        slotReclaiming = 2      // Taken from a stale client; freed once no client thread is inside
+    };
+
+    /**
+     * A client thread enters the slot (numUsers) and then checks the
+     * generation before every ring access; the daemon bumps the generation
+     * and then waits for numUsers to drain before rebuilding the rings. So a
+     * client that stalled past its heartbeat can never touch rings being
+     * rebuilt, or handed to another client.
+     */
+    struct ClientSlot
+    {
+        std::atomic<juce::uint32> state { slotFree };
+        std::atomic<juce::uint32> generation { 0 };     // Bumped when the daemon reclaims the slot
+        std::atomic<juce::uint32> numUsers { 0 };       // Client threads inside the rings right now
+        std::atomic<juce::int64> heartbeatMs { 0 };
+        MpscQueue<BridgeEvent, 4096> toDaemon;
+        MpscQueue<BridgeEvent, 1024> toClient;
+    };
+
+    struct Header
+    {
+        std::atomic<juce::uint32> magic { 0 };
+        juce::uint32 version = layoutVersion;
+        juce::uint32 regionSize = 0;
+        std::atomic<juce::uint32> daemonGeneration { 0 };   // Bumped on every daemon start
+        std::atomic<juce::int64> daemonHeartbeatMs { 0 };
+        std::atomic<juce::uint32> outputsOpen { 0 };
+        std::atomic<juce::uint32> consoleLive { 0 };
+        char portStatus[256] {};                            // Written once, before magic is set
+    };
+
+    struct Region
+    {
+        Header header;
+        std::array<ClientSlot, maxClients> clients;
+    };
+
+    static_assert(std::atomic<juce::uint32>::is_always_lock_free && std::atomic<juce::int64>::is_always_lock_free,
+                  "Shared memory needs address-free atomics");
+
+    //==============================================================================
+    /** The file both sides map */
+    static juce::File getSharedFile();
+
+    /**
+     * Maps the shared file. The daemon creates and lays it out; clients only
+     * map an existing file of the right size. Returns nullptr on failure.
+     */
+    static std::unique_ptr<BridgeSharedMemory> openForDaemon(juce::String& errorMessage);
+    static std::unique_ptr<BridgeSharedMemory> openForClient();
+
+    Region& getRegion() const noexcept      { return *region; }
+
+    /** True if a daemon with this layout has published a heartbeat recently */
+    bool isDaemonAlive() const noexcept;
+
+    /** Daemon: takes a slot from its client, so no client uses it from now on */
+    static void retireSlot(ClientSlot& slot) noexcept;
+
+    /**
+     * Daemon: rebuilds a retired slot's rings and frees it, once no client
+     * thread is left inside. Returns false (try again later) if one is.
+     */
+    static bool tryFreeSlot(ClientSlot& slot) noexcept;
+
+    static juce::int64 now() noexcept       { return juce::Time::currentTimeMillis(); }
+
+    /**
+     * A Time::getMillisecondCounterHiRes() time, as the low 32 bits of its
+     * microseconds. The counter is system-wide, and the difference from now
+     * stays exact across wraps for over an hour, so the other process can
+     * turn it back into a time on its own counter.
+     */
+    static juce::uint32 toEventTime(double timeMs) noexcept
+    {
+        return (juce::uint32) (juce::int64) (timeMs * 1000.0);
+    }
+
+    static double fromEventTime(juce::uint32 timeMicros) noexcept
+    {
+        auto nowMs = juce::Time::getMillisecondCounterHiRes();
+        return nowMs - (juce::uint32) (toEventTime(nowMs) - timeMicros) / 1000.0;
+    }
+
+private:
+    //==============================================================================
+    BridgeSharedMemory() = default;
+
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    Region* region = nullptr;
+
+    bool map(const juce::File& file);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BridgeSharedMemory)
+};
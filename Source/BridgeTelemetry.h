@@ -0,0 +1,162 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - BridgeTelemetry.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "ConsoleLayout.h"
+#include "ConsoleTransport.h"
+
+//==============================================================================
+/**
+ * BridgeTelemetry
+ *
+ * A router's running totals: messages and bytes per port and direction,
+ * sends skipped because the console already had the value, console moves
+ * not echoed back, controllers that decode to nothing, and messages per
+ * console channel.
+ *
+ * Every counter is a relaxed atomic add, so counting is safe and cheap on
+ * the audio, MIDI and message threads alike, and getSnapshot() reads them
+ * all at any time without locks. Counters only ever grow; rates come from
+ * the difference between two snapshots (see TelemetryComponent and
+ * TelemetryLogger).
+ *
+ * Sent counts are what the router handed to its transport; a value the
+ * transport coalesced away before it reached the wire still counts.
+ */
+class BridgeTelemetry
+{
+public:
+    //==============================================================================
+    using Layout = CinemixConsole;
+
+    static constexpr int numPorts = 2;
+    static constexpr int numStrips = Layout::numChannels + 1;   // Channels, then the master section
+
+    struct PortTotals
+    {
+        juce::uint64 messagesSent = 0;
+        juce::uint64 bytesSent = 0;
+        juce::uint64 messagesReceived = 0;
+        juce::uint64 bytesReceived = 0;
+    };
+
+    struct Snapshot
+    {
+        double timeMs = 0.0;        // Time::getMillisecondCounterHiRes()
+        std::array<PortTotals, numPorts> ports {};
+        juce::uint64 deduplicatedSends = 0;
+        juce::uint64 suppressedEchoes = 0;
+        juce::uint64 decodeMisses = 0;
+        std::array<juce::uint32, numStrips> stripMessages {};   // Both directions
+        std::array<ConsoleTransport::QueueStats, numPorts> queues {};
+    };
+
+    //==============================================================================
+    BridgeTelemetry() = default;
+
+    /** Console strip (see numStrips) a parameter belongs to, or -1 */
+    static constexpr int getStrip(int paramIndex) noexcept
+    {
+        if (paramIndex < 0 || paramIndex >= Layout::totalParameters)
+            return -1;
+
+        auto channel = Layout::channelOfParameter(paramIndex);
+        return channel >= 0 ? channel : Layout::numChannels;
+    }
+
+    /** Counts messages handed to the transport; paramIndex -1 for commands */
+    void countSent(int portIndex, int paramIndex, int numMessages, int numBytes) noexcept
+    {
+        if (portIndex < 1 || portIndex > numPorts)
+            return;
+
+        auto& port = sent.ports[(size_t) (portIndex - 1)];
+        port.messages.fetch_add((juce::uint64) numMessages, std::memory_order_relaxed);
+        port.bytes.fetch_add((juce::uint64) numBytes, std::memory_order_relaxed);
+        countStrip(sent, paramIndex, numMessages);
+    }
+
+    /** Counts a message from the console; paramIndex -1 if it decodes to nothing */
+    void countReceived(int portIndex, int paramIndex, int numBytes) noexcept
+    {
+        if (portIndex < 1 || portIndex > numPorts)
+            return;
+
+        auto& port = received.ports[(size_t) (portIndex - 1)];
+        port.messages.fetch_add(1, std::memory_order_relaxed);
+        port.bytes.fetch_add((juce::uint64) numBytes, std::memory_order_relaxed);
+        countStrip(received, paramIndex, 1);
+    }
+
+    void countDeduplicated(int numSends = 1) noexcept   { sent.deduplicated.fetch_add((juce::uint64) numSends, std::memory_order_relaxed); }
+    void countSuppressedEcho() noexcept                 { sent.suppressedEchoes.fetch_add(1, std::memory_order_relaxed); }
+    void countDecodeMiss() noexcept                     { received.decodeMisses.fetch_add(1, std::memory_order_relaxed); }
+
+    /** Reads every counter. Queue figures belong to the transport and are left alone. */
+    void getSnapshot(Snapshot& snapshot) const noexcept
+    {
+        snapshot.timeMs = juce::Time::getMillisecondCounterHiRes();
+
+        for (size_t i = 0; i < (size_t) numPorts; ++i)
+        {
+            snapshot.ports[i].messagesSent = sent.ports[i].messages.load(std::memory_order_relaxed);
+            snapshot.ports[i].bytesSent = sent.ports[i].bytes.load(std::memory_order_relaxed);
+            snapshot.ports[i].messagesReceived = received.ports[i].messages.load(std::memory_order_relaxed);
+            snapshot.ports[i].bytesReceived = received.ports[i].bytes.load(std::memory_order_relaxed);
+        }
+
+        snapshot.deduplicatedSends = sent.deduplicated.load(std::memory_order_relaxed);
+        snapshot.suppressedEchoes = sent.suppressedEchoes.load(std::memory_order_relaxed);
+        snapshot.decodeMisses = received.decodeMisses.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < (size_t) numStrips; ++i)
+            snapshot.stripMessages[i] = sent.strips[i].load(std::memory_order_relaxed)
+                                        + received.strips[i].load(std::memory_order_relaxed);
+    }
+
+private:
+    //==============================================================================
+    struct PortCounters
+    {
+        std::atomic<juce::uint64> messages { 0 };
+        std::atomic<juce::uint64> bytes { 0 };
+    };
+
+    // Sending (audio, message threads) and receiving (MIDI thread) on separate cache lines
+    struct alignas(64) Direction
+    {
+        std::array<PortCounters, numPorts> ports;
+        std::array<std::atomic<juce::uint32>, numStrips> strips {};
+        std::atomic<juce::uint64> deduplicated { 0 };
+        std::atomic<juce::uint64> suppressedEchoes { 0 };
+        std::atomic<juce::uint64> decodeMisses { 0 };
+    };
+
+    Direction sent, received;
+
+    static void countStrip(Direction& direction, int paramIndex, int numMessages) noexcept
+    {
+        auto strip = getStrip(paramIndex);
+
+        if (strip >= 0)
+            direction.strips[(size_t) strip].fetch_add((juce::uint32) numMessages, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE (BridgeTelemetry)
+};
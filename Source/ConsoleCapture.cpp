@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleCapture.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "ConsoleCapture.h"
+#include "RealtimeAudit.h"
+
+//==============================================================================
+ConsoleCapture::ConsoleCapture()
+{
+    held.reserve((size_t) capacity);
+}
+
+void ConsoleCapture::prepare(double sampleRate)
+{
+    if (sampleRate > 0.0)
+        currentSampleRate = sampleRate;
+
+    expectedSample = -1;
+}
+
+//==============================================================================
+bool ConsoleCapture::add(int paramIndex, float value, double timeMs) noexcept
+{
+    if (!enabled.load() || !capturing.load())
+        return false;
+
+    return arrived.push({ timeMs, paramIndex, value });
+}
+
+void ConsoleCapture::collectArrived()
+{
+    TimedChange change;
+
+    while (arrived.pop(change))
+    {
+        // No room left: the oldest held move goes out now
+        if (held.size() == held.capacity())
+            deliverHeld(1);
+
+        // Two ports can interleave slightly out of order; keep held sorted
+        held.push_back(change);
+
+        for (auto i = held.size() - 1; i > 0 && held[i - 1].timeMs > held[i].timeMs; --i)
+            std::swap(held[i - 1], held[i]);
+    }
+}
+
+void ConsoleCapture::deliverHeld(size_t count)
+{
+    count = juce::jmin(count, held.size());
+
+    if (onCapturedChange != nullptr)
+        for (size_t i = 0; i < count; ++i)
+            onCapturedChange(held[i].paramIndex, held[i].value);
+
+    held.erase(held.begin(), held.begin() + (std::ptrdiff_t) count);
+}
+
+//==============================================================================
+void ConsoleCapture::processBlock(juce::AudioPlayHead* playHead, int numSamples)
+{
+    CINEMIX_RT_AUDIT_SCOPE("ConsoleCapture::processBlock");
+
+    // Taken first: the block's samples start now on the wall clock
+    auto blockStartMs = juce::Time::getMillisecondCounterHiRes();
+
+    const juce::SpinLock::ScopedTryLockType sl(consumerLock);
+    if (!sl.isLocked())
+        return;
+
+    juce::Optional<juce::AudioPlayHead::PositionInfo> position;
+    if (playHead != nullptr)
+        position = playHead->getPosition();
+
+    bool hostPlaying = enabled.load() && position.hasValue() && position->getIsPlaying()
+                       && position->getTimeInSamples().hasValue();
+
+    collectArrived();
+
+    if (!hostPlaying)
+    {
+        capturing = false;
+        expectedSample = -1;
+        deliverHeld(held.size());
+        return;
+    }
+
+    // Transport start, locate or loop: what's held belongs to the old position
+    auto blockSample = *position->getTimeInSamples();
+
+    if (blockSample != expectedSample)
+        deliverHeld(held.size());
+
+    expectedSample = blockSample + numSamples;
+    capturing = true;
+
+    // Moves whose time plus the offset falls before the end of this block
+    auto blockEndMs = blockStartMs + numSamples * 1000.0 / currentSampleRate;
+    auto offset = offsetMs.load();
+    size_t numDue = 0;
+
+    while (numDue < held.size() && held[numDue].timeMs + offset < blockEndMs)
+    {
+        if (held[numDue].timeMs + offset < blockStartMs)
+            numLate.fetch_add(1, std::memory_order_relaxed);
+
+        ++numDue;
+    }
+
+    deliverHeld(numDue);
+}
+
+void ConsoleCapture::flush()
+{
+    const juce::SpinLock::ScopedLockType sl(consumerLock);
+
+    capturing = false;
+    expectedSample = -1;
+    collectArrived();
+    deliverHeld(held.size());
+}
@@ -0,0 +1,119 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleCapture.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <vector>
+#include "MpscQueue.h"
+
+//==============================================================================
+/**
+ * ConsoleCapture
+ *
+ * Places console moves on the host timeline by when they were made rather
+ * than when they happened to reach the plugin.
+ *
+ * Without it, each move is written to the host as soon as the MIDI callback
+ * fires, late by the interface, driver and dispatch latency plus wherever
+ * the host's block boundary falls - a delay that differs on every pass.
+ * With it, while the host is playing, each move keeps the device timestamp
+ * it arrived with and is held until the audio block that contains that
+ * time plus a fixed offset. Every move then lands the same distance from
+ * when it was made, pass after pass, so punch-ins line up.
+ *
+ * The offset is calibrated by the user: just above the worst input latency
+ * plus one audio block (the latency probe's P99 is a good start for the
+ * former). Moves that arrive later than that go out at once and are
+ * counted as late. A playhead jump or stop releases everything held, since
+ * it no longer belongs to what's playing.
+ *
+ * add() is lock-free from any thread. processBlock() runs on the audio
+ * thread, and flush() covers the time the host doesn't call it.
+ */
+class ConsoleCapture
+{
+public:
+    //==============================================================================
+    static constexpr double defaultOffsetMs = 20.0;
+    static constexpr double maxOffsetMs = 250.0;
+
+    ConsoleCapture();
+
+    /** Called in order, from processBlock() or flush(), for every move that's due */
+    std::function<void(int paramIndex, float value)> onCapturedChange;
+
+    //==============================================================================
+    void setEnabled(bool shouldBeEnabled) noexcept      { enabled = shouldBeEnabled; }
+    bool isEnabled() const noexcept                     { return enabled.load(); }
+
+    /** How long after a move was made it's written (0 - maxOffsetMs) */
+    void setOffsetMs(double newOffsetMs) noexcept       { offsetMs = juce::jlimit(0.0, maxOffsetMs, newOffsetMs); }
+    double getOffsetMs() const noexcept                 { return offsetMs.load(); }
+
+    /** Moves that arrived after their offset had already passed */
+    juce::int64 getNumLate() const noexcept             { return numLate.load(); }
+
+    //==============================================================================
+    void prepare(double sampleRate);
+
+    /**
+     * Holds a console move for timed delivery (any thread). timeMs is when
+     * it arrived, on the Time::getMillisecondCounterHiRes() clock. Returns
+     * false when the move should go to the host straight away instead:
+     * disabled, the host isn't playing, or there's no room.
+     */
+    bool add(int paramIndex, float value, double timeMs) noexcept;
+
+    /** Delivers the moves due in this block (audio thread) */
+    void processBlock(juce::AudioPlayHead* playHead, int numSamples);
+
+    /** Delivers everything held; for when processBlock() isn't being called */
+    void flush();
+
+private:
+    //==============================================================================
+    struct TimedChange
+    {
+        double timeMs = 0.0;
+        int paramIndex = -1;
+        float value = 0.0f;
+    };
+
+    static constexpr int capacity = 4096;
+
+    std::atomic<bool> enabled { false };
+    std::atomic<double> offsetMs { defaultOffsetMs };
+    std::atomic<juce::int64> numLate { 0 };
+
+    // Set while the host is playing, so add() knows processBlock() will collect
+    std::atomic<bool> capturing { false };
+
+    MpscQueue<TimedChange, capacity> arrived;
+
+    // One consumer at a time: the audio thread, or flush() while it's idle
+    juce::SpinLock consumerLock;
+
+    // Consumer only: held moves in time order, reserved up front
+    std::vector<TimedChange> held;
+    double currentSampleRate = 44100.0;
+    juce::int64 expectedSample = -1;
+
+    void collectArrived();
+    void deliverHeld(size_t count);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ConsoleCapture)
+};
@@ -0,0 +1,471 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleCodec.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include "ConsoleLayout.h"
+
+//==============================================================================
+/**
+ * ConsoleCodec
+ *
+ * The Cinemix wire protocol in one place: how parameter values become
+ * controller values and bytes, and how bytes from the console become
+ * parameter events. Everything is constexpr, works on caller-provided
+ * buffers, and uses no JUCE objects, so it never allocates and can be
+ * checked at compile time (see roundTripsEveryParameter()).
+ *
+ * Value rules (encodeValue):
+ * - Faders: 14-bit, sent as an MSB/LSB controller pair; optionally rounded
+ *   to a coarser resolution (quantiseFaderValue), and on the wire only the
+ *   half the console doesn't already have (getFaderHalves)
+ * - Joystick axes: 0-127
+ * - Mutes and joystick mutes: 2 = off, 3 = on
+ * - AUX mutes: all on CC#96; the value picks the mute, (slot * 2) + 2 = off,
+ *   + 3 = on
+ * Every kind uses offset + (int) (clamped value * scale), so whole parameter
+ * vectors can be encoded without branches (see MidiMappingTable::Encoding).
+ *
+ * MidiRouter uses the value rules with whatever mapping is loaded; the
+ * message encoder and the stream Decoder also work straight from the
+ * built-in layout.
+ */
+template <typename Layout>
+struct ConsoleCodec
+{
+    //==============================================================================
+    using Kind = typename Layout::Kind;
+    using MidiMapping = typename Layout::MidiMapping;
+
+    /** Most bytes one parameter encodes to: a fader's two controller messages */
+    static constexpr int maxBytesPerParameter = 6;
+
+    /**
+     * The largest float below 2: (int) (x * switchScale) is 1 exactly when
+     * x > 0.5, for every float x in 0-1 (checked exhaustively), so switches
+     * need no comparison.
+     */
+    static constexpr float switchScale = 1.99999988f;
+
+    //==============================================================================
+    // Values
+
+    static constexpr float getScale(Kind kind) noexcept
+    {
+        switch (kind)
+        {
+            case Kind::fader:           return 16383.0f;
+            case Kind::joystickAxis:    return 127.0f;
+            case Kind::mute:
+            case Kind::joystickMute:
+            case Kind::auxMute:         break;
+        }
+
+        return switchScale;
+    }
+
+    static constexpr int getOffset(Kind kind, int auxSlot) noexcept
+    {
+        switch (kind)
+        {
+            case Kind::fader:
+            case Kind::joystickAxis:    return 0;
+            case Kind::mute:
+            case Kind::joystickMute:    return 2;
+            case Kind::auxMute:         break;
+        }
+
+        return 2 + 2 * auxSlot;
+    }
+
+    /** Controller value for a normalised value (14-bit for faders); NaN counts as 0 */
+    static constexpr int encodeValue(Kind kind, int auxSlot, float value) noexcept
+    {
+        auto clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+        return getOffset(kind, auxSlot) + (int) (clamped * getScale(kind));
+    }
+
+    /** Normalised value of a received controller value (faders: the MSB alone) */
+    static constexpr float decodeValue(Kind kind, int controllerValue) noexcept
+    {
+        auto value = controllerValue < 0 ? 0 : (controllerValue > 127 ? 127 : controllerValue);
+
+        switch (kind)
+        {
+            case Kind::fader:
+            case Kind::joystickAxis:    return (float) value / 127.0f;
+            case Kind::mute:
+            case Kind::joystickMute:    return value == 3 ? 1.0f : 0.0f;
+            case Kind::auxMute:         break;
+        }
+
+        return (value & 1) != 0 ? 1.0f : 0.0f;
+    }
+
+    /** Normalised value of a complete 14-bit fader value */
+    static constexpr float decodeFaderValue(int value14Bit) noexcept
+    {
+        return (float) (value14Bit < 0 ? 0 : (value14Bit > 16383 ? 16383 : value14Bit)) / 16383.0f;
+    }
+
+    /** The AUX mute a CC#96 value refers to (0-9), or -1 */
+    static constexpr int getAuxSlot(int controllerValue) noexcept
+    {
+        auto slot = (controllerValue - 2) / 2;
+        return (controllerValue >= 2 && slot < Layout::numAuxMutes) ? slot : -1;
+    }
+
+    //==============================================================================
+    // Fader resolution
+
+    static constexpr int fullFaderResolution = 14;
+    static constexpr int minFaderResolution = 7;
+
+    /**
+     * Rounds a 14-bit fader value to the nearest step of a coarser resolution
+     * (7-14 bits). Values that would round past 16383 take the top step, so
+     * full scale at 7 bits is MSB 127 with LSB 0 and still only needs the MSB.
+     */
+    static constexpr int quantiseFaderValue(int value14Bit, int resolutionBits) noexcept
+    {
+        auto bits = resolutionBits < minFaderResolution ? minFaderResolution
+                                                        : (resolutionBits > fullFaderResolution ? fullFaderResolution : resolutionBits);
+        auto step = 1 << (fullFaderResolution - bits);
+        auto rounded = ((value14Bit + step / 2) / step) * step;
+
+        // Full scale is the top step (16383 itself only at 14 bits)
+        return rounded > 16383 ? (16383 & ~(step - 1)) : rounded;
+    }
+
+    enum FaderHalf { sendMsb = 1, sendLsb = 2 };
+
+    /**
+     * Which halves of a fader pair (sendMsb | sendLsb) take a receiver that
+     * last got previous14Bit (-1 = unknown) to value14Bit. A MIDI 1.0
+     * receiver keeps its MSB when only an LSB arrives and resets its LSB to 0
+     * when an MSB arrives, so:
+     * - MSB unchanged: the LSB alone, or nothing if that's unchanged too
+     * - MSB changed and the new LSB 0: the MSB alone
+     * - Otherwise (or unknown): both, MSB first
+     */
+    static constexpr int getFaderHalves(int previous14Bit, int value14Bit) noexcept
+    {
+        if (previous14Bit < 0)
+            return sendMsb | sendLsb;
+
+        if ((previous14Bit >> 7) == (value14Bit >> 7))
+            return (previous14Bit & 0x7F) != (value14Bit & 0x7F) ? sendLsb : 0;
+
+        return (value14Bit & 0x7F) == 0 ? sendMsb : sendMsb | sendLsb;
+    }
+
+    //==============================================================================
+    // Messages
+
+    /**
+     * Writes a parameter's controller message(s) for a mapping into dest and
+     * returns the number of bytes written: 6 for faders (MSB, then LSB), 3
+     * otherwise, 0 if they don't fit.
+     */
+    static constexpr int encodeMessage(const MidiMapping& mapping, int auxSlot, float value,
+                                       juce::uint8* dest, int destSize) noexcept
+    {
+        auto status = (juce::uint8) (0xB0 | ((mapping.midiChannel - 1) & 0x0F));
+        auto encoded = encodeValue(mapping.kind, auxSlot, value);
+
+        if (mapping.isFader())
+        {
+            if (destSize < 6)
+                return 0;
+
+            dest[0] = status;
+            dest[1] = (juce::uint8) mapping.ccNumber;
+            dest[2] = (juce::uint8) ((encoded >> 7) & 0x7F);
+            dest[3] = status;
+            dest[4] = (juce::uint8) mapping.ccNumber2;
+            dest[5] = (juce::uint8) (encoded & 0x7F);
+            return 6;
+        }
+
+        if (destSize < 3)
+            return 0;
+
+        dest[0] = status;
+        dest[1] = (juce::uint8) mapping.ccNumber;
+        dest[2] = (juce::uint8) (encoded & 0x7F);
+        return 3;
+    }
+
+    /** encodeMessage() for a parameter of the built-in layout; the bytes go to its port */
+    static constexpr int encodeParameter(int paramIndex, float value, juce::uint8* dest, int destSize) noexcept
+    {
+        if (paramIndex < 0 || paramIndex >= Layout::totalParameters)
+            return 0;
+
+        const auto& mapping = Layout::mappings[(size_t) paramIndex];
+        return encodeMessage(mapping, getBuiltInAuxSlot(paramIndex), value, dest, destSize);
+    }
+
+    static constexpr int getBuiltInAuxSlot(int paramIndex) noexcept
+    {
+        return (paramIndex >= Layout::auxMuteStart && paramIndex <= Layout::auxMuteEnd) ? paramIndex - Layout::auxMuteStart : -1;
+    }
+
+    //==============================================================================
+    // Decoding
+
+    struct Event
+    {
+        int paramIndex = -1;
+        float value = 0.0f;
+    };
+
+    /**
+     * Turns the console's byte streams (one per port) into parameter events,
+     * using the built-in layout. Handles running status, skips system and
+     * non-controller messages, and ignores real-time bytes wherever they
+     * appear. A fader's MSB gives a 7-bit event at once; its LSB then
+     * refines it to the full 14 bits.
+     */
+    class Decoder
+    {
+    public:
+        constexpr Decoder() noexcept
+        {
+            for (auto& msb : faderMsbs)
+                msb = -1;
+        }
+
+        /**
+         * Decodes bytes received on a port (1 or 2) into events and returns how
+         * many were written. Room for size / 2 events is always enough; any
+         * beyond maxEvents are lost.
+         */
+        constexpr int decode(int portIndex, const juce::uint8* data, int size, Event* events, int maxEvents) noexcept
+        {
+            if (portIndex < 1 || portIndex > 2)
+                return 0;
+
+            auto& state = ports[(size_t) (portIndex - 1)];
+            int numEvents = 0;
+
+            for (int i = 0; i < size; ++i)
+            {
+                auto byte = data[i];
+
+                if (byte >= 0xF8)
+                    continue;  // Real-time: may appear anywhere, changes nothing
+
+                if (byte >= 0x80)
+                {
+                    // System messages (and SysEx) cancel running status
+                    state.status = byte < 0xF0 ? byte : 0;
+                    state.hasData1 = false;
+                    continue;
+                }
+
+                if (state.status == 0)
+                    continue;
+
+                auto type = state.status & 0xF0;
+
+                // Program change and channel pressure have one data byte
+                if (type == 0xC0 || type == 0xD0)
+                    continue;
+
+                if (!state.hasData1)
+                {
+                    state.data1 = byte;
+                    state.hasData1 = true;
+                    continue;
+                }
+
+                state.hasData1 = false;
+
+                if (type != 0xB0 || numEvents >= maxEvents)
+                    continue;
+
+                auto event = decodeController(portIndex, (state.status & 0x0F) + 1, state.data1, byte);
+
+                if (event.paramIndex >= 0)
+                    events[numEvents++] = event;
+            }
+
+            return numEvents;
+        }
+
+    private:
+        struct PortState
+        {
+            juce::uint8 status = 0;
+            juce::uint8 data1 = 0;
+            bool hasData1 = false;
+        };
+
+        std::array<PortState, 2> ports {};
+        std::array<juce::int8, Layout::totalParameters> faderMsbs {};   // -1 = none received yet
+
+        constexpr Event decodeController(int portIndex, int midiChannel, int ccNumber, int value) noexcept
+        {
+            const auto& input = inputs[(size_t) Layout::reverseIndex(portIndex, midiChannel, ccNumber)];
+            Event event;
+
+            switch (input.role)
+            {
+                case Role::none:
+                    break;
+
+                case Role::value:
+                    event = { input.paramIndex, decodeValue(Layout::mappings[(size_t) input.paramIndex].kind, value) };
+                    break;
+
+                case Role::faderMsb:
+                    faderMsbs[(size_t) input.paramIndex] = (juce::int8) value;
+                    event = { input.paramIndex, decodeValue(Kind::fader, value) };
+                    break;
+
+                case Role::faderLsb:
+                    if (auto msb = faderMsbs[(size_t) input.paramIndex]; msb >= 0)
+                        event = { input.paramIndex, decodeFaderValue((msb << 7) | value) };
+                    break;
+
+                case Role::sharedAuxMute:
+                    if (auto slot = getAuxSlot(value); slot >= 0)
+                        event = { Layout::auxMuteStart + slot, decodeValue(Kind::auxMute, value) };
+                    break;
+            }
+
+            return event;
+        }
+    };
+
+    //==============================================================================
+    /**
+     * Encodes a spread of values for every parameter of the layout, decodes
+     * the bytes again and checks each comes back as the same parameter and
+     * the same controller value. Evaluated by the compiler (see below).
+     */
+    static constexpr bool roundTripsEveryParameter() noexcept
+    {
+        constexpr float testValues[] = { 0.0f, 1.0f / 16383.0f, 0.25f, 0.5f, 0.50000006f, 0.754f, 0.99f, 1.0f, -1.0f, 2.0f };
+
+        for (int paramIndex = 0; paramIndex < Layout::totalParameters; ++paramIndex)
+        {
+            const auto& mapping = Layout::mappings[(size_t) paramIndex];
+            auto auxSlot = getBuiltInAuxSlot(paramIndex);
+
+            for (auto value : testValues)
+            {
+                juce::uint8 bytes[maxBytesPerParameter] {};
+                auto numBytes = encodeParameter(paramIndex, value, bytes, maxBytesPerParameter);
+
+                Decoder decoder;
+                Event events[maxBytesPerParameter] {};
+                auto numEvents = decoder.decode(mapping.portIndex, bytes, numBytes, events, maxBytesPerParameter);
+
+                // Faders give their MSB event, then the full value
+                if (numEvents != (mapping.isFader() ? 2 : 1))
+                    return false;
+
+                const auto& last = events[numEvents - 1];
+
+                if (last.paramIndex != paramIndex
+                    || encodeValue(mapping.kind, auxSlot, last.value) != encodeValue(mapping.kind, auxSlot, value))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    //==============================================================================
+    enum class Role : juce::uint8
+    {
+        none,
+        value,
+        faderMsb,
+        faderLsb,
+        sharedAuxMute
+    };
+
+    struct Input
+    {
+        int paramIndex = -1;
+        Role role = Role::none;
+    };
+
+    static constexpr std::array<Input, 2 * 16 * 128> createInputs() noexcept
+    {
+        std::array<Input, 2 * 16 * 128> table {};
+
+        for (int i = 0; i < Layout::totalParameters; ++i)
+        {
+            const auto& mapping = Layout::mappings[(size_t) i];
+            auto& input = table[(size_t) Layout::reverseIndex(mapping.portIndex, mapping.midiChannel, mapping.ccNumber)];
+
+            if (mapping.kind == Kind::auxMute)
+            {
+                input = { Layout::auxMuteStart, Role::sharedAuxMute };
+                continue;
+            }
+
+            input = { i, mapping.isFader() ? Role::faderMsb : Role::value };
+
+            if (mapping.isFader())
+                table[(size_t) Layout::reverseIndex(mapping.portIndex, mapping.midiChannel, mapping.ccNumber2)] = { i, Role::faderLsb };
+        }
+
+        return table;
+    }
+
+    // Received (port, channel, CC) -> what it means; fader LSBs included
+    static const std::array<Input, 2 * 16 * 128> inputs;
+};
+
+template <typename Layout>
+constexpr std::array<typename ConsoleCodec<Layout>::Input, 2 * 16 * 128>
+    ConsoleCodec<Layout>::inputs = ConsoleCodec<Layout>::createInputs();
+
+//==============================================================================
+/** The codec for the frame this build targets */
+using CinemixCodec = ConsoleCodec<CinemixConsole>;
+
+static_assert(CinemixCodec::roundTripsEveryParameter(), "A parameter doesn't survive encoding and decoding");
+static_assert(ConsoleCodec<ConsoleLayout<24>>::roundTripsEveryParameter(), "24-channel round trip failed");
+static_assert(ConsoleCodec<ConsoleLayout<48>>::roundTripsEveryParameter(), "48-channel round trip failed");
+
+// The rules the console firmware expects
+static_assert(CinemixCodec::encodeValue(CinemixCodec::Kind::mute, -1, 0.0f) == 2
+              && CinemixCodec::encodeValue(CinemixCodec::Kind::mute, -1, 1.0f) == 3
+              && CinemixCodec::encodeValue(CinemixCodec::Kind::auxMute, 4, 1.0f) == 4 * 2 + 3
+              && CinemixCodec::encodeValue(CinemixCodec::Kind::fader, -1, 1.0f) == 16383
+              && CinemixCodec::encodeValue(CinemixCodec::Kind::joystickAxis, -1, 0.5f) == 63,
+              "Mutes are 2/3, AUX mutes (slot * 2) + 2/3, faders 14-bit, joysticks 7-bit");
+
+static_assert(CinemixCodec::quantiseFaderValue(1000, 10) == 1008
+              && CinemixCodec::quantiseFaderValue(16383, 10) == 16368
+              && CinemixCodec::quantiseFaderValue(16383, 7) == 16256
+              && CinemixCodec::quantiseFaderValue(16320, 7) == 16256
+              && CinemixCodec::quantiseFaderValue(16383, 14) == 16383
+              && CinemixCodec::quantiseFaderValue(200, 7) == 256
+              && CinemixCodec::quantiseFaderValue(1234, 14) == 1234,
+              "Fader values round to the nearest step, full scale to the top one");
+
+static_assert(CinemixCodec::getFaderHalves(-1, 0x105) == (CinemixCodec::sendMsb | CinemixCodec::sendLsb)
+              && CinemixCodec::getFaderHalves(0x105, 0x109) == CinemixCodec::sendLsb
+              && CinemixCodec::getFaderHalves(0x105, 0x105) == 0
+              && CinemixCodec::getFaderHalves(0x105, 0x200) == CinemixCodec::sendMsb
+              && CinemixCodec::getFaderHalves(0x105, 0x205) == (CinemixCodec::sendMsb | CinemixCodec::sendLsb),
+              "Only the fader halves a receiver doesn't already have are sent");
@@ -0,0 +1,461 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleLayout.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+// Frame size the plugin is built for (24, 36 or 48 - any count from 1 to 48 works)
+#ifndef CINEMIX_CONSOLE_CHANNELS
+ #define CINEMIX_CONSOLE_CHANNELS 36
+#endif
+
+//==============================================================================
+/**
+ * ConsoleLayout
+ *
+ * Compile-time description of a Cinemix frame. The parameter index ranges,
+ * the parameter -> MIDI mapping table and the MIDI -> parameter lookup table
+ * are all generated from the channel count, so a different frame size is just
+ * a different template argument.
+ *
+ * Parameter order:
+ *   upper faders, lower faders, upper mutes, lower mutes, AUX mutes,
+ *   joystick 1 X/Y/mute, joystick 2 X/Y/mute, master fader
+ *
+ * MIDI layout per bank (one bank per port):
+ * - Port 1, channels 1-24: faders on MIDI ch 1 (upper CC pairs from 0,
+ *   lower from 48), mutes on MIDI ch 3 (upper CCs from 0, lower from 24)
+ * - Port 2, channels 25-48: faders on MIDI ch 2, mutes on MIDI ch 4. Up to
+ *   12 channels the lower rows follow the upper rows (CC 24 / CC 12); beyond
+ *   that they start past the joystick CCs (CC 56 / CC 28)
+ * - Port 2 also carries the master section: joysticks on ch 2/4, AUX mutes
+ *   and the master fader on ch 5
+ */
+template <int NumChannels>
+struct ConsoleLayout
+{
+    static_assert(NumChannels >= 1 && NumChannels <= 48, "A Cinemix frame has 1-48 channels");
+
+    //==============================================================================
+    static constexpr int numChannels = NumChannels;
+    static constexpr int numPort1Channels = NumChannels < 24 ? NumChannels : 24;
+    static constexpr int numPort2Channels = NumChannels - numPort1Channels;
+
+    static constexpr int numFaders = numChannels * 2;
+    static constexpr int numMutes = numChannels * 2;
+    static constexpr int numAuxMutes = 10;
+
+    static constexpr int faderStart = 0;
+    static constexpr int faderEnd = faderStart + numFaders - 1;
+    static constexpr int muteStart = faderEnd + 1;
+    static constexpr int muteEnd = muteStart + numMutes - 1;
+    static constexpr int auxMuteStart = muteEnd + 1;
+    static constexpr int auxMuteEnd = auxMuteStart + numAuxMutes - 1;
+    static constexpr int joy1X = auxMuteEnd + 1;
+    static constexpr int joy1Y = joy1X + 1;
+    static constexpr int joy1Mute = joy1X + 2;
+    static constexpr int joy2X = joy1X + 3;
+    static constexpr int joy2Y = joy1X + 4;
+    static constexpr int joy2Mute = joy1X + 5;
+    static constexpr int masterFader = joy1X + 6;
+    static constexpr int totalParameters = masterFader + 1;
+
+    // Each row is a contiguous block: all upper faders, then all lower faders
+    static constexpr int upperFaderIndex(int channel) noexcept { return faderStart + channel; }
+    static constexpr int lowerFaderIndex(int channel) noexcept { return faderStart + numChannels + channel; }
+    static constexpr int upperMuteIndex(int channel) noexcept  { return muteStart + channel; }
+    static constexpr int lowerMuteIndex(int channel) noexcept  { return muteStart + numChannels + channel; }
+
+    /** The channel (0-based) a fader or mute belongs to; -1 for the master section */
+    static constexpr int channelOfParameter(int index) noexcept
+    {
+        if (index >= faderStart && index <= faderEnd)
+            return (index - faderStart) % numChannels;
+
+        if (index >= muteStart && index <= muteEnd)
+            return (index - muteStart) % numChannels;
+
+        return -1;
+    }
+
+    //==============================================================================
+    enum class Kind : juce::uint8
+    {
+        fader,          // 14-bit, MSB/LSB CC pair
+        mute,           // 2 = off, 3 = on
+        auxMute,        // Shared CC#96, value (aux * 2) + 2 = off, + 3 = on
+        joystickAxis,   // 7-bit
+        joystickMute    // 2 = off, 3 = on
+    };
+
+    // Byte-sized fields: a whole frame's mapping fits in a few cache lines
+    struct MidiMapping
+    {
+        juce::int8 midiChannel = 1;     // MIDI channel (1-16)
+        juce::int8 ccNumber = 0;        // Primary CC number (MSB for faders)
+        juce::int8 ccNumber2 = -1;      // LSB CC for faders, -1 otherwise
+        juce::int8 portIndex = 1;       // Output port: 1 or 2
+        Kind kind = Kind::mute;
+
+        constexpr MidiMapping() = default;
+
+        constexpr MidiMapping(int channel, int cc, int cc2, int port, Kind controlKind) noexcept
+            : midiChannel((juce::int8) channel), ccNumber((juce::int8) cc), ccNumber2((juce::int8) cc2),
+              portIndex((juce::int8) port), kind(controlKind)
+        {
+        }
+
+        constexpr bool isFader() const noexcept { return kind == Kind::fader; }
+    };
+
+    static_assert(sizeof(MidiMapping) == 5, "MidiMapping is packed");
+
+    // Parameter -> MIDI (index = parameter index)
+    static const std::array<MidiMapping, totalParameters> mappings;
+
+    // MIDI -> parameter, by (port, channel, CC). Fader LSBs aren't listed; all
+    // AUX mutes share one entry, which resolves to the first AUX mute.
+    static const std::array<juce::int16, 2 * 16 * 128> reverseMappings;
+
+    static constexpr int reverseIndex(int portIndex, int midiChannel, int ccNumber) noexcept
+    {
+        return ((portIndex - 1) * 16 + (midiChannel - 1)) * 128 + ccNumber;
+    }
+
+    /** Returns the parameter for an incoming CC, or -1 */
+    static int findParameterIndex(int portIndex, int midiChannel, int ccNumber) noexcept
+    {
+        if (portIndex < 1 || portIndex > 2 || midiChannel < 1 || midiChannel > 16 || ccNumber < 0 || ccNumber > 127)
+            return -1;
+
+        return reverseMappings[(size_t) reverseIndex(portIndex, midiChannel, ccNumber)];
+    }
+
+    //==============================================================================
+    static constexpr std::array<MidiMapping, totalParameters> createMappings()
+    {
+        std::array<MidiMapping, totalParameters> table {};
+
+        // Lower rows on port 2 move past the joystick CCs once the upper rows reach them
+        constexpr int port2LowerFaderBase = numPort2Channels <= 12 ? 24 : 56;
+        constexpr int port2LowerMuteBase = numPort2Channels <= 12 ? 12 : 28;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            bool onPort1 = channel < numPort1Channels;
+            int bankChannel = onPort1 ? channel : channel - numPort1Channels;
+            int port = onPort1 ? 1 : 2;
+            int faderMidiChannel = onPort1 ? 1 : 2;
+            int muteMidiChannel = onPort1 ? 3 : 4;
+            int lowerFaderBase = onPort1 ? 48 : port2LowerFaderBase;
+            int lowerMuteBase = onPort1 ? 24 : port2LowerMuteBase;
+
+            table[(size_t) upperFaderIndex(channel)] = { faderMidiChannel, bankChannel * 2, bankChannel * 2 + 1, port, Kind::fader };
+            table[(size_t) lowerFaderIndex(channel)] = { faderMidiChannel, lowerFaderBase + bankChannel * 2,
+                                                         lowerFaderBase + bankChannel * 2 + 1, port, Kind::fader };
+            table[(size_t) upperMuteIndex(channel)] = { muteMidiChannel, bankChannel, -1, port, Kind::mute };
+            table[(size_t) lowerMuteIndex(channel)] = { muteMidiChannel, lowerMuteBase + bankChannel, -1, port, Kind::mute };
+        }
+
+        for (int aux = 0; aux < numAuxMutes; ++aux)
+            table[(size_t) (auxMuteStart + aux)] = { 5, 96, -1, 2, Kind::auxMute };
+
+        table[(size_t) joy1X]       = { 2, 48, -1, 2, Kind::joystickAxis };
+        table[(size_t) joy1Y]       = { 2, 50, -1, 2, Kind::joystickAxis };
+        table[(size_t) joy1Mute]    = { 4, 24, -1, 2, Kind::joystickMute };
+        table[(size_t) joy2X]       = { 2, 52, -1, 2, Kind::joystickAxis };
+        table[(size_t) joy2Y]       = { 2, 54, -1, 2, Kind::joystickAxis };
+        table[(size_t) joy2Mute]    = { 4, 26, -1, 2, Kind::joystickMute };
+        table[(size_t) masterFader] = { 5, 0, 1, 2, Kind::fader };
+
+        return table;
+    }
+
+    static constexpr std::array<juce::int16, 2 * 16 * 128> createReverseMappings()
+    {
+        std::array<juce::int16, 2 * 16 * 128> table {};
+
+        auto mappingTable = createMappings();
+
+        for (auto& entry : table)
+            entry = -1;
+
+        // Last write wins for the shared AUX CC, so fill backwards
+        for (int i = totalParameters - 1; i >= 0; --i)
+        {
+            const auto& mapping = mappingTable[(size_t) i];
+            table[(size_t) reverseIndex(mapping.portIndex, mapping.midiChannel, mapping.ccNumber)] = (juce::int16) i;
+        }
+
+        return table;
+    }
+
+    /**
+     * True if no two parameters share a CC (the AUX mutes' shared CC#96 counts
+     * once, as their values differ) and none collides with the console's
+     * system CCs: activation (CC#65/#127, ch 5) and SEL switches (CC#64-111,
+     * ch 3 and 4).
+     */
+    static constexpr bool mappingsAreUnique()
+    {
+        std::array<int, 2 * 16 * 128> uses {};
+
+        for (int port = 1; port <= 2; ++port)
+        {
+            ++uses[(size_t) reverseIndex(port, 5, 65)];
+            ++uses[(size_t) reverseIndex(port, 5, 127)];
+
+            for (int cc = 64; cc <= 111; ++cc)
+                ++uses[(size_t) reverseIndex(port, port == 1 ? 3 : 4, cc)];
+        }
+
+        auto table = createMappings();
+
+        for (int i = 0; i < totalParameters; ++i)
+        {
+            const auto& mapping = table[(size_t) i];
+
+            if (mapping.kind == Kind::auxMute && i != auxMuteStart)
+                continue;
+
+            if (mapping.portIndex < 1 || mapping.portIndex > 2
+                || mapping.midiChannel < 1 || mapping.midiChannel > 16
+                || mapping.ccNumber < 0 || mapping.ccNumber >= 120
+                || mapping.isFader() != (mapping.ccNumber2 >= 0) || mapping.ccNumber2 >= 120)
+                return false;
+
+            ++uses[(size_t) reverseIndex(mapping.portIndex, mapping.midiChannel, mapping.ccNumber)];
+
+            if (mapping.isFader())
+                ++uses[(size_t) reverseIndex(mapping.portIndex, mapping.midiChannel, mapping.ccNumber2)];
+        }
+
+        for (auto count : uses)
+            if (count > 1)
+                return false;
+
+        return true;
+    }
+
+    //==============================================================================
+    // Names and IDs (IDs are what hosts store - they must never change)
+
+    /** A parameter's ID and display name, generated at compile time */
+    struct ParameterText
+    {
+        char id[16] {};
+        char name[24] {};
+    };
+
+    /** Host-visible parameter group; each covers a contiguous index range */
+    struct ParameterGroup
+    {
+        const char* id;
+        const char* name;
+        int firstIndex, lastIndex;
+    };
+
+    static constexpr std::array<ParameterGroup, 7> parameterGroups {{
+        { "faders_upper", "Upper Faders", faderStart, faderStart + numChannels - 1 },
+        { "faders_lower", "Lower Faders", faderStart + numChannels, faderEnd },
+        { "mutes_upper",  "Upper Mutes",  muteStart, muteStart + numChannels - 1 },
+        { "mutes_lower",  "Lower Mutes",  muteStart + numChannels, muteEnd },
+        { "aux_mutes",    "AUX Mutes",    auxMuteStart, auxMuteEnd },
+        { "joysticks",    "Joysticks",    joy1X, joy2Mute },
+        { "master",       "Master",       masterFader, masterFader }
+    }};
+
+    static const std::array<ParameterText, totalParameters> parameterTexts;
+
+    /** Display name: M1-M24, then S1-S4 and further mono channels on larger frames */
+    static juce::String getChannelName(int channel)
+    {
+        ParameterText text;
+        int length = 0;
+        appendChannelName(text.name, length, channel);
+        return text.name;
+    }
+
+    static juce::String getParameterID(int index)
+    {
+        return (index >= 0 && index < totalParameters) ? juce::String(parameterTexts[(size_t) index].id) : juce::String();
+    }
+
+    static juce::String getParameterName(int index)
+    {
+        return (index >= 0 && index < totalParameters) ? juce::String(parameterTexts[(size_t) index].name) : juce::String();
+    }
+
+    //==============================================================================
+    template <size_t Size>
+    static constexpr void appendText(char (&buffer)[Size], int& length, const char* text)
+    {
+        while (*text != 0 && length < (int) Size - 1)
+            buffer[length++] = *text++;
+    }
+
+    template <size_t Size>
+    static constexpr void appendNumber(char (&buffer)[Size], int& length, int number)
+    {
+        char digits[8] {};
+        int numDigits = 0;
+
+        do
+        {
+            digits[numDigits++] = (char) ('0' + number % 10);
+            number /= 10;
+        }
+        while (number > 0);
+
+        while (numDigits > 0 && length < (int) Size - 1)
+            buffer[length++] = digits[--numDigits];
+    }
+
+    template <size_t Size>
+    static constexpr void appendChannelName(char (&buffer)[Size], int& length, int channel)
+    {
+        if (channel < 24)       { appendText(buffer, length, "M"); appendNumber(buffer, length, channel + 1); }
+        else if (channel < 28)  { appendText(buffer, length, "S"); appendNumber(buffer, length, channel - 23); }
+        else                    { appendText(buffer, length, "M"); appendNumber(buffer, length, channel - 3); }
+    }
+
+    static constexpr std::array<ParameterText, totalParameters> createParameterTexts()
+    {
+        std::array<ParameterText, totalParameters> table {};
+
+        for (int index = 0; index < totalParameters; ++index)
+        {
+            auto& text = table[(size_t) index];
+            int idLength = 0, nameLength = 0;
+
+            auto channelControl = [&](const char* idPrefix, int offset, const char* namePrefix)
+            {
+                appendText(text.id, idLength, idPrefix);
+                appendNumber(text.id, idLength, offset);
+                appendText(text.name, nameLength, namePrefix);
+                appendText(text.name, nameLength, offset < numChannels ? "Upper " : "Lower ");
+                appendChannelName(text.name, nameLength, offset % numChannels);
+            };
+
+            auto fixed = [&](const char* id, const char* name)
+            {
+                appendText(text.id, idLength, id);
+                appendText(text.name, nameLength, name);
+            };
+
+            if (index <= faderEnd)
+            {
+                channelControl("fader_", index - faderStart, "Fader ");
+            }
+            else if (index <= muteEnd)
+            {
+                channelControl("mute_", index - muteStart, "Mute ");
+            }
+            else if (index <= auxMuteEnd)
+            {
+                appendText(text.id, idLength, "aux_mute_");
+                appendNumber(text.id, idLength, index - auxMuteStart);
+                appendText(text.name, nameLength, "AUX ");
+                appendNumber(text.name, nameLength, index - auxMuteStart + 1);
+                appendText(text.name, nameLength, " Mute");
+            }
+            else if (index == joy1X)     { fixed("joy1_x", "Joystick 1 X"); }
+            else if (index == joy1Y)     { fixed("joy1_y", "Joystick 1 Y"); }
+            else if (index == joy1Mute)  { fixed("joy1_mute", "Joystick 1 Mute"); }
+            else if (index == joy2X)     { fixed("joy2_x", "Joystick 2 X"); }
+            else if (index == joy2Y)     { fixed("joy2_y", "Joystick 2 Y"); }
+            else if (index == joy2Mute)  { fixed("joy2_mute", "Joystick 2 Mute"); }
+            else                         { fixed("master_fader", "Master Fader"); }
+        }
+
+        return table;
+    }
+
+    static constexpr bool textEquals(const char* a, const char* b)
+    {
+        while (*a != 0 && *a == *b)
+            ++a, ++b;
+
+        return *a == *b;
+    }
+
+    /** Inverse of getParameterID - returns -1 for unknown IDs */
+    static int getParameterIndex(const juce::String& parameterID)
+    {
+        auto indexWithin = [&parameterID](const char* prefix, int count) -> int
+        {
+            if (!parameterID.startsWith(prefix))
+                return -1;
+
+            auto suffix = parameterID.substring((int) std::strlen(prefix));
+            int index = suffix.getIntValue();
+            return (suffix.containsOnly("0123456789") && index < count) ? index : -1;
+        };
+
+        if (auto i = indexWithin("fader_", numFaders); i >= 0)        return faderStart + i;
+        if (auto i = indexWithin("mute_", numMutes); i >= 0)          return muteStart + i;
+        if (auto i = indexWithin("aux_mute_", numAuxMutes); i >= 0)   return auxMuteStart + i;
+
+        for (int index = joy1X; index <= masterFader; ++index)
+            if (parameterID == getParameterID(index))
+                return index;
+
+        return -1;
+    }
+};
+
+template <int NumChannels>
+constexpr std::array<typename ConsoleLayout<NumChannels>::MidiMapping, ConsoleLayout<NumChannels>::totalParameters>
+    ConsoleLayout<NumChannels>::mappings = ConsoleLayout<NumChannels>::createMappings();
+
+template <int NumChannels>
+constexpr std::array<juce::int16, 2 * 16 * 128>
+    ConsoleLayout<NumChannels>::reverseMappings = ConsoleLayout<NumChannels>::createReverseMappings();
+
+template <int NumChannels>
+constexpr std::array<typename ConsoleLayout<NumChannels>::ParameterText, ConsoleLayout<NumChannels>::totalParameters>
+    ConsoleLayout<NumChannels>::parameterTexts = ConsoleLayout<NumChannels>::createParameterTexts();
+
+//==============================================================================
+/** The frame this build targets */
+using CinemixConsole = ConsoleLayout<CINEMIX_CONSOLE_CHANNELS>;
+
+static_assert(CinemixConsole::mappingsAreUnique(), "Two parameters share a MIDI mapping");
+static_assert(ConsoleLayout<24>::mappingsAreUnique(), "24-channel layout has a MIDI mapping clash");
+static_assert(ConsoleLayout<36>::mappingsAreUnique(), "36-channel layout has a MIDI mapping clash");
+static_assert(ConsoleLayout<48>::mappingsAreUnique(), "48-channel layout has a MIDI mapping clash");
+
+// The 36-channel frame must keep the mapping existing sessions and consoles use
+static_assert(ConsoleLayout<36>::totalParameters == 161, "36-channel frame has 161 parameters");
+static_assert(ConsoleLayout<36>::mappings[59].ccNumber == 94 && ConsoleLayout<36>::mappings[59].portIndex == 1,
+              "Lower fader M24 is CC#94/95 on port 1");
+static_assert(ConsoleLayout<36>::mappings[60].ccNumber == 24 && ConsoleLayout<36>::mappings[60].midiChannel == 2,
+              "Lower fader S1 is CC#24/25, ch 2 on port 2");
+static_assert(ConsoleLayout<36>::mappings[143].ccNumber == 23 && ConsoleLayout<36>::mappings[143].midiChannel == 4,
+              "Last lower mute is CC#23, ch 4");
+static_assert(ConsoleLayout<36>::mappings[160].ccNumber == 0 && ConsoleLayout<36>::mappings[160].midiChannel == 5,
+              "Master fader is CC#0/1, ch 5");
+
+// Parameter IDs are stored in host sessions
+static_assert(ConsoleLayout<36>::textEquals(ConsoleLayout<36>::parameterTexts[71].id, "fader_71")
+              && ConsoleLayout<36>::textEquals(ConsoleLayout<36>::parameterTexts[72].id, "mute_0")
+              && ConsoleLayout<36>::textEquals(ConsoleLayout<36>::parameterTexts[153].id, "aux_mute_9")
+              && ConsoleLayout<36>::textEquals(ConsoleLayout<36>::parameterTexts[160].id, "master_fader"),
+              "Parameter IDs must never change");
+static_assert(ConsoleLayout<36>::textEquals(ConsoleLayout<36>::parameterTexts[59].name, "Fader Lower M24")
+              && ConsoleLayout<36>::textEquals(ConsoleLayout<36>::parameterTexts[63].name, "Fader Lower S4")
+              && ConsoleLayout<48>::textEquals(ConsoleLayout<48>::parameterTexts[47].name, "Fader Upper M44"),
+              "Parameter names follow the console's channel labels");
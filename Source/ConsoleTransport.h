@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleTransport.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+ * ConsoleTransport
+ *
+ * How MidiRouter reaches the console: either the devices in this process
+ * (MidiPortHub) or a bridge daemon that owns them (BridgeClient).
+ *
+ * All send methods are lock-free and may be called from any thread.
+ */
+class ConsoleTransport
+{
+public:
+    //==============================================================================
+    virtual ~ConsoleTransport() = default;
+
+    /**
+     * Receives console input (on a MIDI or transport thread). A message's
+     * timestamp is when it arrived, in seconds on the
+     * Time::getMillisecondCounterHiRes() clock as MidiInput stamps it, or 0
+     * if the transport doesn't know.
+     */
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+        virtual void handleConsoleMessage(int portIndex, const juce::MidiMessage& message) = 0;
+
+        /**
+         * Called (on a background thread) when a lost output device came back.
+         * Coalesced values queued meanwhile are still sent; if needsFullResync
+         * is true the console may have been power-cycled, isConsoleLive() has
+         * been cleared, and the console needs initialising again.
+         */
+        virtual void consoleReconnected(bool needsFullResync) { juce::ignoreUnused(needsFullResync); }
+    };
+
+    /** Registers a client; removeClient() doesn't return while the client is being called */
+    virtual void addClient(Client* client) = 0;
+    virtual void removeClient(Client* client) = 0;
+
+    //==============================================================================
+    // Devices
+
+    /**
+     * The devices as last enumerated. Enumeration happens in the background,
+     * so this never blocks (and is empty until the first scan finishes).
+     * Port indices refer to these lists.
+     */
+    virtual juce::Array<juce::MidiDeviceInfo> getAvailableInputs() const = 0;
+    virtual juce::Array<juce::MidiDeviceInfo> getAvailableOutputs() const = 0;
+
+    /**
+     * Opens (or joins) the console ports by device index (-1 = don't use).
+     * Devices are remembered by identifier and reopened if they come back
+     * after being unplugged.
+     */
+    virtual bool openPorts(Client* client, int inPort1Index, int inPort2Index,
+                           int outPort1Index, int outPort2Index) = 0;
+
+    /** Stops using the client's ports */
+    virtual void releasePorts(Client* client) = 0;
+
+    /** True if both output ports are open */
+    virtual bool areOutputsOpen() const = 0;
+
+    /** Returns status string for display */
+    virtual juce::String getPortStatusString() const = 0;
+
+    /**
+     * True once the console has been initialised on the current ports, so a
+     * new or restarted instance can skip the initialisation sequence.
+     */
+    virtual bool isConsoleLive() const = 0;
+    virtual void setConsoleLive(bool isLive) = 0;
+
+    //==============================================================================
+    // Output
+
+    /** Queues a message to be sent in order (not coalesced). dueTimeMs 0 = now. */
+    virtual void sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs = 0.0) = 0;
+
+    /** Queues a block of messages in order. Sample positions are relative to startTimeMs. */
+    virtual void sendBlock(int portIndex, const juce::MidiBuffer& buffer, double startTimeMs, double sampleRate) = 0;
+
+    /** Queues a 7-bit controller value, replacing one still waiting for the same CC */
+    virtual void sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value) = 0;
+
+    /**
+     * Queues a 14-bit MSB/LSB pair, replacing one still waiting for the same
+     * fader. Only the half the console doesn't already have may go out (see
+     * ConsoleCodec::getFaderHalves).
+     */
+    virtual void sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit) = 0;
+
+    /**
+     * Sends the next value of every fader as a full pair again, for when the
+     * console may have lost track of them. Lock-free.
+     */
+    virtual void forgetSentFaderValues() {}
+
+    //==============================================================================
+    // Telemetry
+
+    struct QueueStats
+    {
+        int depth = 0;          // Messages and coalesced controls waiting now
+        int highWater = 0;      // The most there have ever been
+    };
+
+    /** Lock-free. Transports that don't queue output themselves report nothing. */
+    virtual QueueStats getQueueStats(int portIndex) const { juce::ignoreUnused(portIndex); return {}; }
+};
@@ -0,0 +1,312 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleViewComponent.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "ConsoleViewComponent.h"
+
+namespace
+{
+    const juce::Colour stripColour = juce::Colours::darkgrey.darker();
+    const juce::Colour muteOnColour = juce::Colours::red.darker();
+    const juce::Colour thumbColour = juce::Colours::lightgrey;
+}
+
+//==============================================================================
+ConsoleViewComponent::ConsoleViewComponent(const juce::Array<juce::AudioProcessorParameter*>& processorParameters,
+                                           ParameterMirror& parameterMirror)
+    : mirror(parameterMirror)
+{
+    controlIndices.fill(-1);
+
+    for (int channel = 0; channel < CinemixConsole::numChannels; ++channel)
+    {
+        const int indices[controlsPerStrip] = { CinemixConsole::upperMuteIndex(channel), CinemixConsole::upperFaderIndex(channel),
+                                                CinemixConsole::lowerMuteIndex(channel), CinemixConsole::lowerFaderIndex(channel) };
+
+        for (int i = 0; i < controlsPerStrip; ++i)
+        {
+            auto controlIndex = channel * controlsPerStrip + i;
+            auto& control = controls[(size_t) controlIndex];
+            control.parameter = processorParameters[indices[i]];
+            control.paramIndex = indices[i];
+            control.isFader = (i % 2) == 1;
+            controlIndices[(size_t) indices[i]] = (juce::int16) controlIndex;
+        }
+    }
+
+    setOpaque(true);
+    startTimerHz(refreshRateHz);
+}
+
+ConsoleViewComponent::~ConsoleViewComponent()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void ConsoleViewComponent::resized()
+{
+    auto stripHeight = getHeight();
+    auto halfHeight = (stripHeight - 14) / 2;
+
+    for (int channel = 0; channel < CinemixConsole::numChannels; ++channel)
+    {
+        juce::Rectangle<int> strip(channel * stripWidth, 0, stripWidth, stripHeight);
+        strip.removeFromTop(14);  // Channel name
+
+        for (int row = 0; row < 2; ++row)
+        {
+            auto area = strip.removeFromTop(halfHeight).reduced(2);
+            area.removeFromTop(14);  // Row label
+
+            auto& mute = controls[(size_t) (channel * controlsPerStrip + row * 2)];
+            auto& fader = controls[(size_t) (channel * controlsPerStrip + row * 2 + 1)];
+
+            mute.bounds = area.removeFromTop(18).reduced(1);
+            area.removeFromTop(2);
+            fader.bounds = area;
+        }
+    }
+
+    renderBackground();
+
+    // Positions depend on the size: take a fresh snapshot of everything
+    for (auto& control : controls)
+    {
+        control.thumbY = -1;
+        refreshControl(control);
+    }
+
+    repaint();
+}
+
+void ConsoleViewComponent::renderBackground()
+{
+    auto scale = juce::Component::getApproximateScaleFactorForComponent(this);
+
+    background = juce::Image(juce::Image::RGB,
+                             juce::jmax(1, juce::roundToInt((float) getWidth() * scale)),
+                             juce::jmax(1, juce::roundToInt((float) getHeight() * scale)),
+                             true);
+
+    juce::Graphics g(background);
+    g.addTransform(juce::AffineTransform::scale(scale));
+    g.fillAll(stripColour);
+
+    for (int channel = 0; channel < CinemixConsole::numChannels; ++channel)
+    {
+        juce::Rectangle<int> strip(channel * stripWidth, 0, stripWidth, getHeight());
+        auto midY = 14 + (getHeight() - 14) / 2;
+
+        g.setColour(juce::Colours::black);
+        g.drawRect(strip, 1);
+
+        g.setColour(juce::Colours::grey);
+        g.drawLine((float) strip.getX(), (float) midY, (float) strip.getRight(), (float) midY, 1.0f);
+
+        g.setColour(juce::Colours::white);
+        g.setFont(10.0f);
+        g.drawText(CinemixConsole::getChannelName(channel), strip.getX(), 2, stripWidth, 12, juce::Justification::centred);
+
+        g.setColour(juce::Colours::lightgrey);
+        g.setFont(9.0f);
+        g.drawText("Chan", strip.getX(), 16, stripWidth, 14, juce::Justification::centred);
+        g.drawText("Mix", strip.getX(), midY + 2, stripWidth, 14, juce::Justification::centred);
+
+        for (int i = 0; i < controlsPerStrip; ++i)
+        {
+            const auto& control = controls[(size_t) (channel * controlsPerStrip + i)];
+
+            if (control.isFader)
+            {
+                // Track only; the thumb is drawn on top every frame
+                g.setColour(juce::Colours::black);
+                g.fillRect(control.bounds.withSizeKeepingCentre(3, control.bounds.getHeight() - thumbHeight));
+            }
+            else
+            {
+                // Off state; paint() covers it while the mute is on
+                g.setColour(juce::Colours::grey.darker());
+                g.fillRect(control.bounds);
+                g.setColour(juce::Colours::white);
+                g.setFont(10.0f);
+                g.drawText("M", control.bounds, juce::Justification::centred);
+            }
+        }
+    }
+}
+
+//==============================================================================
+void ConsoleViewComponent::paint(juce::Graphics& g)
+{
+    auto clip = g.getClipBounds();
+
+    g.drawImage(background, getLocalBounds().toFloat());
+
+    for (const auto& control : controls)
+    {
+        if (control.isFader)
+        {
+            auto thumb = getThumbBounds(control, control.thumbY);
+
+            if (thumb.intersects(clip))
+            {
+                g.setColour(thumbColour);
+                g.fillRect(thumb);
+            }
+        }
+        else if (control.value >= 0.5f && control.bounds.intersects(clip))
+        {
+            g.setColour(muteOnColour);
+            g.fillRect(control.bounds);
+            g.setColour(juce::Colours::white);
+            g.setFont(10.0f);
+            g.drawText("M", control.bounds, juce::Justification::centred);
+        }
+    }
+}
+
+//==============================================================================
+// Display Refresh
+
+void ConsoleViewComponent::timerCallback()
+{
+    // Only what changed since the last frame, however often it changed
+    ParameterMirror::Mask changes;
+    if (!mirror.takeChanges(ParameterMirror::editor, changes))
+        return;
+
+    changes.forEach([this](int paramIndex)
+    {
+        auto controlIndex = controlIndices[(size_t) paramIndex];
+        if (controlIndex >= 0)
+            refreshControl(controls[(size_t) controlIndex]);
+    });
+}
+
+void ConsoleViewComponent::refreshControl(Control& control)
+{
+    auto value = mirror.get(control.paramIndex);
+
+    if (control.isFader)
+    {
+        auto thumbY = getThumbY(control, value);
+        control.value = value;
+
+        if (thumbY == control.thumbY)
+            return;  // Moved less than a pixel
+
+        if (control.thumbY >= 0)
+            repaint(getThumbBounds(control, control.thumbY));
+
+        control.thumbY = thumbY;
+        repaint(getThumbBounds(control, thumbY));
+        return;
+    }
+
+    if ((value >= 0.5f) != (control.value >= 0.5f))
+        repaint(control.bounds);
+
+    control.value = value;
+}
+
+juce::Rectangle<int> ConsoleViewComponent::getThumbBounds(const Control& control, int thumbY) const
+{
+    return { control.bounds.getX(), thumbY, control.bounds.getWidth(), thumbHeight };
+}
+
+int ConsoleViewComponent::getThumbY(const Control& control, float value) const
+{
+    auto travel = control.bounds.getHeight() - thumbHeight;
+    return control.bounds.getBottom() - thumbHeight - juce::roundToInt(juce::jlimit(0.0f, 1.0f, value) * (float) travel);
+}
+
+float ConsoleViewComponent::getFaderValueAt(const Control& control, int y) const
+{
+    auto travel = juce::jmax(1, control.bounds.getHeight() - thumbHeight);
+    auto fromBottom = control.bounds.getBottom() - thumbHeight / 2 - y;
+    return juce::jlimit(0.0f, 1.0f, (float) fromBottom / (float) travel);
+}
+
+ConsoleViewComponent::Control* ConsoleViewComponent::getControlAt(juce::Point<int> position)
+{
+    auto channel = position.getX() / stripWidth;
+    if (position.getX() < 0 || channel >= CinemixConsole::numChannels)
+        return nullptr;
+
+    for (int i = 0; i < controlsPerStrip; ++i)
+    {
+        auto& control = controls[(size_t) (channel * controlsPerStrip + i)];
+        if (control.bounds.contains(position))
+            return &control;
+    }
+
+    return nullptr;
+}
+
+//==============================================================================
+// Mouse
+
+void ConsoleViewComponent::mouseDown(const juce::MouseEvent& event)
+{
+    auto* control = getControlAt(event.getPosition());
+    if (control == nullptr || control->parameter == nullptr)
+        return;
+
+    control->parameter->beginChangeGesture();
+
+    if (control->isFader)
+    {
+        dragging = control;
+        control->parameter->setValueNotifyingHost(getFaderValueAt(*control, event.y));
+    }
+    else
+    {
+        control->parameter->setValueNotifyingHost(control->parameter->getValue() >= 0.5f ? 0.0f : 1.0f);
+        control->parameter->endChangeGesture();
+    }
+
+    // Immediate feedback for the control under the mouse
+    refreshControl(*control);
+}
+
+void ConsoleViewComponent::mouseDrag(const juce::MouseEvent& event)
+{
+    if (dragging == nullptr)
+        return;
+
+    dragging->parameter->setValueNotifyingHost(getFaderValueAt(*dragging, event.y));
+    refreshControl(*dragging);
+}
+
+void ConsoleViewComponent::mouseUp(const juce::MouseEvent&)
+{
+    if (dragging == nullptr)
+        return;
+
+    dragging->parameter->endChangeGesture();
+    dragging = nullptr;
+}
+
+void ConsoleViewComponent::mouseDoubleClick(const juce::MouseEvent& event)
+{
+    // Faders return to their default (unity gain)
+    auto* control = getControlAt(event.getPosition());
+    if (control == nullptr || !control->isFader || control->parameter == nullptr)
+        return;
+
+    control->parameter->beginChangeGesture();
+    control->parameter->setValueNotifyingHost(control->parameter->getDefaultValue());
+    control->parameter->endChangeGesture();
+    refreshControl(*control);
+}
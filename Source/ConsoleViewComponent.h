@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ConsoleViewComponent.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "ConsoleLayout.h"
+#include "ParameterMirror.h"
+
+//==============================================================================
+/**
+ * ConsoleViewComponent
+ *
+ * Every channel strip of the console (upper and lower fader and mute per
+ * channel) drawn by one component, with no child components or
+ * attachments.
+ *
+ * Everything that doesn't move - strips, labels, fader tracks, mutes in the
+ * off state - is rendered once into a cached image. A timer at a fixed
+ * display rate takes the parameters that changed from the processor's
+ * ParameterMirror, and repaints only the fader thumbs that moved by at
+ * least a pixel and the mutes that changed state.
+ * JUCE merges those rectangles into a single paint per frame, so the cost
+ * doesn't grow with the number of moving faders or how often the host or
+ * console updates them.
+ *
+ * Per strip (22 px wide):
+ * ┌────────┐
+ * │   M1   │ Channel name
+ * │  Chan  │ Upper row label
+ * │ [Mute] │ Upper mute
+ * │   ║    │ Upper fader
+ * ├────────┤
+ * │  Mix   │ Lower row label
+ * │ [Mute] │ Lower mute
+ * │   ║    │ Lower fader
+ * └────────┘
+ */
+class ConsoleViewComponent : public juce::Component,
+                             private juce::Timer
+{
+public:
+    //==============================================================================
+    /** Parameters must be the processor's, in CinemixConsole order, and mirrored by parameterMirror */
+    ConsoleViewComponent(const juce::Array<juce::AudioProcessorParameter*>& processorParameters,
+                         ParameterMirror& parameterMirror);
+    ~ConsoleViewComponent() override;
+
+    static constexpr int stripWidth = 22;
+    static constexpr int refreshRateHz = 30;
+
+    /** Width that shows every strip */
+    static constexpr int getPreferredWidth() noexcept   { return CinemixConsole::numChannels * stripWidth; }
+
+    //==============================================================================
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+    void mouseDown(const juce::MouseEvent& event) override;
+    void mouseDrag(const juce::MouseEvent& event) override;
+    void mouseUp(const juce::MouseEvent& event) override;
+    void mouseDoubleClick(const juce::MouseEvent& event) override;
+
+private:
+    //==============================================================================
+    static constexpr int controlsPerStrip = 4;
+    static constexpr int numControls = CinemixConsole::numChannels * controlsPerStrip;
+    static constexpr int thumbHeight = 8;
+
+    struct Control
+    {
+        juce::AudioProcessorParameter* parameter = nullptr;
+        int paramIndex = -1;
+        juce::Rectangle<int> bounds;
+        bool isFader = false;
+
+        // Snapshot taken by the timer; paint() only ever draws this
+        float value = 0.0f;
+        int thumbY = -1;
+    };
+
+    ParameterMirror& mirror;
+    std::array<Control, numControls> controls;
+    juce::Image background;
+
+    // Control shown for each parameter, or -1
+    std::array<juce::int16, CinemixConsole::totalParameters> controlIndices;
+
+    Control* dragging = nullptr;
+
+    void timerCallback() override;
+
+    /** Takes a new snapshot of one control and repaints it if it looks different */
+    void refreshControl(Control& control);
+
+    void renderBackground();
+    juce::Rectangle<int> getThumbBounds(const Control& control, int thumbY) const;
+    int getThumbY(const Control& control, float value) const;
+    float getFaderValueAt(const Control& control, int y) const;
+    Control* getControlAt(juce::Point<int> position);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ConsoleViewComponent)
+};
@@ -0,0 +1,226 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - FlightRecorder.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "FlightRecorder.h"
+
+//==============================================================================
+FlightRecorder::FlightRecorder()
+    : juce::Thread("Cinemix Flight Recorder")
+{
+    pendingEvents.reserve(eventsPerBlock);
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    stop();
+}
+
+juce::File FlightRecorder::getDefaultRecordingsFolder()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+               .getChildFile("CinemixAutomationBridge")
+               .getChildFile("Recordings");
+}
+
+void FlightRecorder::start()
+{
+    if (isThreadRunning())
+        return;
+
+    // Every session gets its own file, named after its start time
+    auto now = juce::Time::getCurrentTime();
+    sessionFile = getDefaultRecordingsFolder()
+                      .getChildFile("Session_" + now.formatted("%Y-%m-%d_%H-%M-%S") + ".cmxrec")
+                      .getNonexistentSibling();
+
+    sessionStartTicks = juce::Time::getHighResolutionTicks();
+    lastFlushMillis = juce::Time::getMillisecondCounter();
+
+    // Events that slipped in as the last session stopped belong to its timeline
+    Event stale;
+    while (ring.pop(stale)) {}
+
+    recording.store(true, std::memory_order_release);
+    startThread(juce::Thread::Priority::low);
+}
+
+void FlightRecorder::stop()
+{
+    if (!isThreadRunning())
+        return;
+
+    recording.store(false, std::memory_order_relaxed);
+    signalThreadShouldExit();
+    notify();
+    stopThread(2000);
+}
+
+//==============================================================================
+// MIDI Thread
+
+void FlightRecorder::record(int paramIndex, float normalizedValue)
+{
+    if (!recording.load(std::memory_order_acquire))
+        return;
+
+    auto elapsedTicks = juce::Time::getHighResolutionTicks() - sessionStartTicks;
+
+    Event event;
+    event.timeMicros = (juce::int64) (juce::Time::highResolutionTicksToSeconds(elapsedTicks) * 1.0e6);
+    event.paramIndex = (juce::uint16) paramIndex;
+    event.value = (juce::uint16) juce::roundToInt(juce::jlimit(0.0f, 1.0f, normalizedValue) * 16383.0f);
+
+    if (!ring.push(event))
+        ++droppedEvents;
+}
+
+//==============================================================================
+// Writer Thread
+
+void FlightRecorder::run()
+{
+    while (!threadShouldExit())
+    {
+        wait(100);
+        drainRing();
+
+        // Write full blocks straight away, partial ones once they get old enough
+        auto ageMs = juce::Time::getMillisecondCounter() - lastFlushMillis;
+        if (!pendingEvents.empty() && ageMs >= (juce::uint32) maxBlockAgeMs)
+            writeBlock();
+    }
+
+    // Final flush on shutdown
+    drainRing();
+    writeBlock();
+    output.reset();
+}
+
+void FlightRecorder::drainRing()
+{
+    Event event;
+    while (ring.pop(event))
+    {
+        pendingEvents.push_back(event);
+
+        if ((int) pendingEvents.size() >= eventsPerBlock)
+            writeBlock();
+    }
+}
+
+void FlightRecorder::writeBlock()
+{
+    lastFlushMillis = juce::Time::getMillisecondCounter();
+
+    if (pendingEvents.empty())
+        return;
+
+    if (output == nullptr && !openSessionFile())
+    {
+        pendingEvents.clear();
+        return;
+    }
+
+    timeColumn.reset();
+    indexColumn.reset();
+    valueColumn.reset();
+
+    // Column-wise delta encoding: timestamps only ever grow, indices and values
+    // mostly move in small steps, so almost every entry fits in one or two bytes
+    juce::int64 previousTime = pendingEvents.front().timeMicros;
+    juce::int64 previousIndex = 0;
+    juce::int64 previousValue = 0;
+
+    for (const auto& event : pendingEvents)
+    {
+        writeVarint(timeColumn, (juce::uint64) juce::jmax((juce::int64) 0, event.timeMicros - previousTime));
+        writeVarint(indexColumn, zigzagEncode((juce::int64) event.paramIndex - previousIndex));
+        writeVarint(valueColumn, zigzagEncode((juce::int64) event.value - previousValue));
+
+        previousTime = juce::jmax(previousTime, event.timeMicros);
+        previousIndex = event.paramIndex;
+        previousValue = event.value;
+    }
+
+    BlockHeader header {};
+    std::memcpy(header.magic, "BLK1", 4);
+    header.numEvents = (juce::uint32) pendingEvents.size();
+    header.firstTimeMicros = pendingEvents.front().timeMicros;
+    header.lastTimeMicros = previousTime;
+    header.timeColumnBytes = (juce::uint32) timeColumn.getDataSize();
+    header.indexColumnBytes = (juce::uint32) indexColumn.getDataSize();
+    header.valueColumnBytes = (juce::uint32) valueColumn.getDataSize();
+
+    output->write(&header, sizeof(header));
+    output->write(timeColumn.getData(), timeColumn.getDataSize());
+    output->write(indexColumn.getData(), indexColumn.getDataSize());
+    output->write(valueColumn.getData(), valueColumn.getDataSize());
+    output->flush();
+
+    pendingEvents.clear();
+}
+
+bool FlightRecorder::openSessionFile()
+{
+    if (sessionFile.getParentDirectory().createDirectory().failed())
+        return false;
+
+    output = std::make_unique<juce::FileOutputStream>(sessionFile);
+    if (output->failedToOpen())
+    {
+        output.reset();
+        return false;
+    }
+
+    FileHeader header {};
+    std::memcpy(header.magic, "CMXR", 4);
+    header.version = formatVersion;
+    auto elapsedSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks()
+                                                                   - sessionStartTicks);
+    header.sessionStartMillis = juce::Time::currentTimeMillis() - (juce::int64) (elapsedSeconds * 1000.0);
+
+    output->write(&header, sizeof(header));
+    return true;
+}
+
+//==============================================================================
+// Varint Helpers
+
+void FlightRecorder::writeVarint(juce::MemoryOutputStream& out, juce::uint64 value)
+{
+    // LEB128: 7 bits per byte, high bit set on all but the last byte
+    while (value >= 0x80)
+    {
+        out.writeByte((char) ((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    out.writeByte((char) value);
+}
+
+bool FlightRecorder::readVarint(const juce::uint8*& data, const juce::uint8* end, juce::uint64& value)
+{
+    value = 0;
+
+    for (int shift = 0; shift < 64 && data < end; shift += 7)
+    {
+        auto byte = *data++;
+        value |= (juce::uint64) (byte & 0x7F) << shift;
+
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+
+    return false;  // Truncated or malformed
+}
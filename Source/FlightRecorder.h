@@ -0,0 +1,134 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - FlightRecorder.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "MpscQueue.h"
+
+//==============================================================================
+/**
+ * FlightRecorder
+ *
+ * Continuously records every decoded console event so an engineer's moves
+ * survive a DAW crash. record() is wait-free and is called on the MIDI input
+ * thread; a low-priority background thread drains the ring and appends
+ * compressed blocks to a session file.
+ *
+ * File layout (all integers little-endian):
+ * - FileHeader (24 bytes): magic "CMXR", version, session start (ms since epoch)
+ * - Blocks, each a BlockHeader (40 bytes) followed by three columns:
+ *   timestamps (delta, varint), parameter indices (zigzag delta, varint),
+ *   14-bit values (zigzag delta, varint)
+ *
+ * Blocks are self-describing, so a file cut short by a crash can still be
+ * read up to its last complete block. See FlightRecording for the reader.
+ */
+class FlightRecorder : private juce::Thread
+{
+public:
+    //==============================================================================
+    struct Event
+    {
+        juce::int64 timeMicros;   // Microseconds since the session started
+        juce::uint16 paramIndex;  // Parameter index (see CinemixConsole)
+        juce::uint16 value;       // 14-bit value (0-16383)
+    };
+
+    struct FileHeader
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::int64 sessionStartMillis;
+        juce::uint32 reserved[2];
+    };
+
+    struct BlockHeader
+    {
+        char magic[4];
+        juce::uint32 numEvents;
+        juce::int64 firstTimeMicros;
+        juce::int64 lastTimeMicros;
+        juce::uint32 timeColumnBytes;
+        juce::uint32 indexColumnBytes;
+        juce::uint32 valueColumnBytes;
+        juce::uint32 reserved;
+    };
+
+    static_assert(sizeof(FileHeader) == 24, "Flight recorder file header must stay 24 bytes");
+    static_assert(sizeof(BlockHeader) == 40, "Flight recorder block header must stay 40 bytes");
+
+    static constexpr juce::uint32 formatVersion = 1;
+
+    //==============================================================================
+    FlightRecorder();
+    ~FlightRecorder() override;
+
+    /** Returns the folder session recordings are written to */
+    static juce::File getDefaultRecordingsFolder();
+
+    /**
+     * Starts the background writer (does nothing if it's running). The
+     * session file is created on the first block.
+     */
+    void start();
+
+    /** Flushes everything recorded so far and stops the background writer */
+    void stop();
+
+    /** Records one decoded console event (wait-free; called on the MIDI thread); ignored while stopped */
+    void record(int paramIndex, float normalizedValue);
+
+    /** Returns the current session file (may not exist yet if nothing was recorded) */
+    juce::File getSessionFile() const { return sessionFile; }
+
+    /** Number of events lost because the ring was full */
+    int getNumDroppedEvents() const { return droppedEvents.load(); }
+
+    //==============================================================================
+    // Varint helpers shared with FlightRecording
+    static void writeVarint(juce::MemoryOutputStream& out, juce::uint64 value);
+    static bool readVarint(const juce::uint8*& data, const juce::uint8* end, juce::uint64& value);
+
+    static juce::uint64 zigzagEncode(juce::int64 value) { return ((juce::uint64) value << 1) ^ (juce::uint64) (value >> 63); }
+    static juce::int64 zigzagDecode(juce::uint64 value) { return (juce::int64) (value >> 1) ^ -(juce::int64) (value & 1); }
+
+private:
+    //==============================================================================
+    static constexpr int ringSize = 16384;
+    static constexpr int eventsPerBlock = 4096;
+    static constexpr int maxBlockAgeMs = 1000;   // Bounds what a crash can lose
+
+    // Lock-free ring between the MIDI input threads and the writer thread
+    MpscQueue<Event, ringSize> ring;
+    std::atomic<int> droppedEvents { 0 };
+    std::atomic<bool> recording { false };
+
+    // Writer thread state
+    std::vector<Event> pendingEvents;
+    juce::MemoryOutputStream timeColumn, indexColumn, valueColumn;
+    std::unique_ptr<juce::FileOutputStream> output;
+    juce::File sessionFile;
+    juce::int64 sessionStartTicks = 0;
+    juce::uint32 lastFlushMillis = 0;
+
+    void run() override;
+    void drainRing();
+    void writeBlock();
+    bool openSessionFile();
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlightRecorder)
+};
@@ -0,0 +1,217 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - FlightRecording.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "FlightRecording.h"
+#include "MidiRouter.h"
+
+//==============================================================================
+FlightRecording::FlightRecording()
+{
+}
+
+FlightRecording::~FlightRecording()
+{
+}
+
+bool FlightRecording::open(const juce::File& recordingFile)
+{
+    blocks.clear();
+    numEvents = 0;
+
+    input = std::make_unique<juce::FileInputStream>(recordingFile);
+    if (input->failedToOpen())
+    {
+        input.reset();
+        return false;
+    }
+
+    FlightRecorder::FileHeader fileHeader;
+    if (input->read(&fileHeader, sizeof(fileHeader)) != (int) sizeof(fileHeader)
+        || std::memcmp(fileHeader.magic, "CMXR", 4) != 0
+        || fileHeader.version != FlightRecorder::formatVersion)
+    {
+        input.reset();
+        return false;
+    }
+
+    sessionStartMillis = fileHeader.sessionStartMillis;
+
+    // Walk the block headers only - payloads are skipped, not read
+    auto totalLength = input->getTotalLength();
+    auto position = (juce::int64) sizeof(fileHeader);
+
+    while (position + (juce::int64) sizeof(FlightRecorder::BlockHeader) <= totalLength)
+    {
+        FlightRecorder::BlockHeader header;
+        input->setPosition(position);
+
+        if (input->read(&header, sizeof(header)) != (int) sizeof(header)
+            || std::memcmp(header.magic, "BLK1", 4) != 0)
+            break;
+
+        auto payloadBytes = (juce::int64) header.timeColumnBytes
+                          + header.indexColumnBytes + header.valueColumnBytes;
+
+        // A crash mid-write leaves a partial block at the end; stop before it
+        if (position + (juce::int64) sizeof(header) + payloadBytes > totalLength)
+            break;
+
+        blocks.push_back({ position, header.firstTimeMicros, header.lastTimeMicros,
+                           header.numEvents, (juce::uint32) payloadBytes });
+        numEvents += header.numEvents;
+
+        position += (juce::int64) sizeof(header) + payloadBytes;
+    }
+
+    return true;
+}
+
+juce::int64 FlightRecording::getStartTimeMicros() const
+{
+    return blocks.empty() ? 0 : blocks.front().firstTimeMicros;
+}
+
+juce::int64 FlightRecording::getEndTimeMicros() const
+{
+    return blocks.empty() ? 0 : blocks.back().lastTimeMicros;
+}
+
+int FlightRecording::findBlockForTime(juce::int64 timeMicros) const
+{
+    // Last block starting at or before the requested time
+    auto it = std::upper_bound(blocks.begin(), blocks.end(), timeMicros,
+                               [](juce::int64 time, const BlockInfo& block)
+                               {
+                                   return time < block.firstTimeMicros;
+                               });
+
+    if (it == blocks.begin())
+        return 0;
+
+    return (int) std::distance(blocks.begin(), it) - 1;
+}
+
+//==============================================================================
+// Decoding
+
+bool FlightRecording::readRange(juce::int64 startMicros, juce::int64 endMicros, std::vector<Event>& dest)
+{
+    dest.clear();
+
+    if (input == nullptr)
+        return false;
+
+    for (int i = findBlockForTime(startMicros); i < (int) blocks.size(); ++i)
+    {
+        const auto& block = blocks[(size_t) i];
+
+        if (block.firstTimeMicros >= endMicros)
+            break;
+
+        if (block.lastTimeMicros < startMicros)
+            continue;
+
+        if (!decodeBlock(block, startMicros, endMicros, dest))
+            return false;
+    }
+
+    return true;
+}
+
+bool FlightRecording::decodeBlock(const BlockInfo& block, juce::int64 startMicros,
+                                  juce::int64 endMicros, std::vector<Event>& dest)
+{
+    FlightRecorder::BlockHeader header;
+    input->setPosition(block.fileOffset);
+
+    if (input->read(&header, sizeof(header)) != (int) sizeof(header))
+        return false;
+
+    payload.setSize(block.payloadBytes, false);
+    if (input->read(payload.getData(), (int) block.payloadBytes) != (int) block.payloadBytes)
+        return false;
+
+    // The three columns sit back to back and are decoded in lockstep
+    auto* timeData = static_cast<const juce::uint8*>(payload.getData());
+    auto* indexData = timeData + header.timeColumnBytes;
+    auto* valueData = indexData + header.indexColumnBytes;
+    auto* timeEnd = indexData;
+    auto* indexEnd = valueData;
+    auto* valueEnd = valueData + header.valueColumnBytes;
+
+    juce::int64 time = header.firstTimeMicros;
+    juce::int64 paramIndex = 0;
+    juce::int64 value = 0;
+
+    for (juce::uint32 i = 0; i < header.numEvents; ++i)
+    {
+        juce::uint64 timeDelta, indexDelta, valueDelta;
+
+        if (!FlightRecorder::readVarint(timeData, timeEnd, timeDelta)
+            || !FlightRecorder::readVarint(indexData, indexEnd, indexDelta)
+            || !FlightRecorder::readVarint(valueData, valueEnd, valueDelta))
+            return false;
+
+        time += (juce::int64) timeDelta;
+        paramIndex += FlightRecorder::zigzagDecode(indexDelta);
+        value += FlightRecorder::zigzagDecode(valueDelta);
+
+        if (time >= startMicros && time < endMicros)
+            dest.push_back({ time, (juce::uint16) paramIndex, (juce::uint16) value });
+    }
+
+    return true;
+}
+
+//==============================================================================
+// MIDI File Export
+
+bool FlightRecording::exportRangeAsMidiFile(juce::int64 startMicros, juce::int64 endMicros,
+                                            const MidiRouter& router, const juce::File& destFile)
+{
+    std::vector<Event> events;
+    if (!readRange(startMicros, endMicros, events))
+        return false;
+
+    // One track per console port
+    juce::MidiMessageSequence portTracks[2];
+    std::array<juce::MidiMessage, 2> messages;
+
+    for (const auto& event : events)
+    {
+        // Centre of the 14-bit step, so re-encoding lands on the recorded value
+        float value = juce::jlimit(0.0f, 1.0f, (event.value + 0.5f) / 16383.0f);
+
+        int portIndex = 1;
+        int numMessages = router.createParameterMessages(event.paramIndex, value, messages, portIndex);
+
+        // 1 tick = 1 ms (see setSmpteTimeFormat below)
+        double tick = (double) (event.timeMicros - startMicros) / 1000.0;
+
+        for (int m = 0; m < numMessages; ++m)
+            portTracks[portIndex == 2 ? 1 : 0].addEvent(messages[(size_t) m], tick);
+    }
+
+    juce::MidiFile midiFile;
+    midiFile.setSmpteTimeFormat(25, 40);  // 25 fps x 40 subframes = 1000 ticks per second
+    midiFile.addTrack(portTracks[0]);
+    midiFile.addTrack(portTracks[1]);
+
+    destFile.deleteFile();
+    juce::FileOutputStream out(destFile);
+    if (out.failedToOpen())
+        return false;
+
+    return midiFile.writeTo(out, 1);
+}
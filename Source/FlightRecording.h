@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - FlightRecording.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+#include "FlightRecorder.h"
+
+class MidiRouter;
+
+//==============================================================================
+/**
+ * FlightRecording
+ *
+ * Reader for session files written by FlightRecorder.
+ *
+ * Opening a file reads only the block headers (each one says how large its
+ * payload is), building an in-memory index of block start times. Seeking to
+ * a timestamp is a binary search over that index, and only the blocks that
+ * overlap the requested range are read and decoded.
+ */
+class FlightRecording
+{
+public:
+    //==============================================================================
+    using Event = FlightRecorder::Event;
+
+    FlightRecording();
+    ~FlightRecording();
+
+    /** Opens a session file and indexes its blocks. A truncated last block is ignored. */
+    bool open(const juce::File& recordingFile);
+
+    int getNumBlocks() const { return (int) blocks.size(); }
+    juce::int64 getNumEvents() const { return numEvents; }
+
+    /** Wall-clock time the session started (ms since epoch) */
+    juce::int64 getSessionStartMillis() const { return sessionStartMillis; }
+
+    /** First and last event time (microseconds since session start) */
+    juce::int64 getStartTimeMicros() const;
+    juce::int64 getEndTimeMicros() const;
+
+    /** Returns the index of the block containing the given time - O(log n) */
+    int findBlockForTime(juce::int64 timeMicros) const;
+
+    /** Reads all events in [startMicros, endMicros) into dest (replacing its contents) */
+    bool readRange(juce::int64 startMicros, juce::int64 endMicros, std::vector<Event>& dest);
+
+    /**
+     * Writes the events in [startMicros, endMicros) as a type 1 standard MIDI
+     * file, encoded exactly as the console expects them. Track 1 carries
+     * port 1 traffic and track 2 port 2 traffic; timing is millisecond SMPTE.
+     */
+    bool exportRangeAsMidiFile(juce::int64 startMicros, juce::int64 endMicros,
+                               const MidiRouter& router, const juce::File& destFile);
+
+private:
+    //==============================================================================
+    struct BlockInfo
+    {
+        juce::int64 fileOffset;     // Offset of the BlockHeader
+        juce::int64 firstTimeMicros;
+        juce::int64 lastTimeMicros;
+        juce::uint32 numEvents;
+        juce::uint32 payloadBytes;
+    };
+
+    std::unique_ptr<juce::FileInputStream> input;
+    std::vector<BlockInfo> blocks;
+    juce::int64 numEvents = 0;
+    juce::int64 sessionStartMillis = 0;
+
+    juce::MemoryBlock payload;
+
+    bool decodeBlock(const BlockInfo& block, juce::int64 startMicros, juce::int64 endMicros,
+                     std::vector<Event>& dest);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlightRecording)
+};
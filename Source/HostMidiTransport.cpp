@@ -0,0 +1,309 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - HostMidiTransport.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "HostMidiTransport.h"
+#include "ConsoleCodec.h"
+#include "PipelineTrace.h"
+
+namespace
+{
+    constexpr juce::uint32 hasValueBit = 1u << 31;
+    constexpr juce::uint32 faderPairBit = 1u << 21;
+}
+
+//==============================================================================
+HostMidiTransport::HostMidiTransport()
+{
+}
+
+HostMidiTransport::~HostMidiTransport()
+{
+}
+
+void HostMidiTransport::prepare(double sampleRate)
+{
+    if (sampleRate > 0.0)
+        currentSampleRate = sampleRate;
+}
+
+//==============================================================================
+// Clients
+
+void HostMidiTransport::addClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->addIfNotAlreadyThere(client);
+    clients.update(std::move(updated));
+}
+
+void HostMidiTransport::removeClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->removeFirstMatchingValue(client);
+    clients.update(std::move(updated));
+}
+
+//==============================================================================
+// Devices (routed by the host)
+
+juce::Array<juce::MidiDeviceInfo> HostMidiTransport::getAvailableInputs() const
+{
+    return {};
+}
+
+juce::Array<juce::MidiDeviceInfo> HostMidiTransport::getAvailableOutputs() const
+{
+    return {};
+}
+
+bool HostMidiTransport::openPorts(Client*, int, int, int, int)
+{
+    return true;
+}
+
+void HostMidiTransport::releasePorts(Client*)
+{
+}
+
+bool HostMidiTransport::areOutputsOpen() const
+{
+    return true;
+}
+
+juce::String HostMidiTransport::getPortStatusString() const
+{
+    return "Host MIDI bus\n"
+           "Port 1: channels 1-8\n"
+           "Port 2: channels 9-16";
+}
+
+//==============================================================================
+// Output (any thread)
+
+int HostMidiTransport::toHostChannel(int portIndex, int midiChannel) noexcept
+{
+    if (portIndex < 1 || portIndex > numPorts || midiChannel < 1 || midiChannel > channelsPerPort)
+        return 0;
+
+    return midiChannel + (portIndex - 1) * channelsPerPort;
+}
+
+bool HostMidiTransport::queue(int portIndex, const juce::uint8* data, int size, double dueTimeMs, int samplePosition)
+{
+    if (portIndex < 1 || portIndex > numPorts || size < 1 || size > 3)
+        return false;
+
+    OrderedMessage message;
+    message.dueTimeMs = dueTimeMs;
+    message.samplePosition = juce::jmax(0, samplePosition);
+    message.size = (juce::uint8) size;
+    std::memcpy(message.data, data, (size_t) size);
+
+    if (data[0] < 0xF0)
+    {
+        auto hostChannel = toHostChannel(portIndex, (data[0] & 0x0F) + 1);
+        if (hostChannel == 0)
+            return false;
+
+        message.data[0] = (juce::uint8) ((data[0] & 0xF0) | (hostChannel - 1));
+    }
+    else if (portIndex != 1)
+    {
+        // System messages have no channel, so port 1's copy reaches both ports
+        return false;
+    }
+
+    // Dropped if the host has stopped calling processBlock for too long
+    if (!ordered.push(message))
+        return false;
+
+    updateHighWater();
+    return true;
+}
+
+void HostMidiTransport::sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs)
+{
+    queue(portIndex, message.getRawData(), message.getRawDataSize(), dueTimeMs, 0);
+}
+
+void HostMidiTransport::sendBlock(int portIndex, const juce::MidiBuffer& buffer, double, double)
+{
+    // The host is the clock here: events keep their positions in the next
+    // rendered block, which is this one if called from processBlock
+    for (const auto metadata : buffer)
+        queue(portIndex, metadata.data, metadata.numBytes, 0.0, metadata.samplePosition);
+}
+
+void HostMidiTransport::sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value)
+{
+    if (toHostChannel(portIndex, midiChannel) == 0 || ccNumber < 0 || ccNumber > 127)
+        return;
+
+    auto key = (juce::uint16) (((portIndex - 1) * 16 + midiChannel - 1) * 128 + ccNumber);
+
+    // Only the first value since the last block queues the CC; later ones just replace it
+    if (pendingValues[key].exchange(hasValueBit | (juce::uint32) (value & 0x7F)) == 0 && pendingKeys.push(key))
+        updateHighWater();
+}
+
+void HostMidiTransport::sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit)
+{
+    if (toHostChannel(portIndex, midiChannel) == 0
+        || msbCcNumber < 0 || msbCcNumber > 127 || lsbCcNumber < 0 || lsbCcNumber > 127)
+        return;
+
+    auto key = (juce::uint16) (((portIndex - 1) * 16 + midiChannel - 1) * 128 + msbCcNumber);
+    auto encoded = hasValueBit | faderPairBit | ((juce::uint32) lsbCcNumber << 14) | (juce::uint32) (value14Bit & 0x3FFF);
+
+    if (pendingValues[key].exchange(encoded) == 0 && pendingKeys.push(key))
+        updateHighWater();
+}
+
+ConsoleTransport::QueueStats HostMidiTransport::getQueueStats(int) const
+{
+    return { ordered.getNumReady() + pendingKeys.getNumReady(), queueHighWater.load(std::memory_order_relaxed) };
+}
+
+void HostMidiTransport::updateHighWater() noexcept
+{
+    auto depth = ordered.getNumReady() + pendingKeys.getNumReady();
+    auto highest = queueHighWater.load(std::memory_order_relaxed);
+
+    while (depth > highest && !queueHighWater.compare_exchange_weak(highest, depth, std::memory_order_relaxed)) {}
+}
+
+//==============================================================================
+// Audio Thread
+
+void HostMidiTransport::receiveBlock(const juce::MidiBuffer& hostInput)
+{
+    if (hostInput.isEmpty())
+        return;
+
+    auto list = clients.read();
+    auto blockStartMs = juce::Time::getMillisecondCounterHiRes();
+
+    for (const auto metadata : hostInput)
+    {
+        PipelineTrace::midi(PipelineTrace::Stage::consoleReceive, metadata.data, metadata.numBytes);
+
+        auto message = metadata.getMessage();
+        int portIndex = 1;
+
+        // Sample positions become times on the same clock a device input uses
+        message.setTimeStamp((blockStartMs + metadata.samplePosition * 1000.0 / currentSampleRate) * 0.001);
+
+        // Port 2 comes in on channels 9-16
+        if (message.getChannel() > channelsPerPort)
+        {
+            portIndex = 2;
+            message.setChannel(message.getChannel() - channelsPerPort);
+        }
+
+        for (auto* client : *list)
+            client->handleConsoleMessage(portIndex, message);
+    }
+}
+
+void HostMidiTransport::renderBlock(juce::MidiBuffer& hostOutput, int numSamples)
+{
+    auto nowMs = juce::Time::getMillisecondCounterHiRes();
+
+    // Ordered traffic first, up to the first message that isn't due yet
+    for (;;)
+    {
+        if (!hasHeldMessage)
+            hasHeldMessage = ordered.pop(heldMessage);
+
+        if (!hasHeldMessage)
+            break;
+
+        double position = heldMessage.samplePosition;
+
+        if (heldMessage.dueTimeMs > 0.0)
+            position += (heldMessage.dueTimeMs - nowMs) * currentSampleRate / 1000.0;
+
+        if (!addToBlock(hostOutput, heldMessage.data, heldMessage.size, position, numSamples))
+            break;
+
+        hasHeldMessage = false;
+    }
+
+    // Then the latest value of every control that changed
+    if (faderValuesUnknown.exchange(false))
+        sentFaderValues.fill(-1);
+
+    juce::uint16 key = 0;
+
+    while (lineFreeAtSample < numSamples && pendingKeys.pop(key))
+    {
+        auto encoded = pendingValues[key].exchange(0);
+        if (encoded == 0)
+            continue;
+
+        int portIndex = key / (16 * 128) + 1;
+        int midiChannel = (key / 128) % 16 + 1;
+        int status = 0xB0 | (toHostChannel(portIndex, midiChannel) - 1);
+        int ccNumber = key % 128;
+
+        if ((encoded & faderPairBit) != 0)
+        {
+            int value14Bit = (int) (encoded & 0x3FFF);
+            const juce::uint8 messages[6] = { (juce::uint8) status, (juce::uint8) ccNumber, (juce::uint8) ((value14Bit >> 7) & 0x7F),
+                                              (juce::uint8) status, (juce::uint8) ((encoded >> 14) & 0x7F), (juce::uint8) (value14Bit & 0x7F) };
+
+            auto& sentValue = sentFaderValues[key];
+            auto halves = CinemixCodec::getFaderHalves(sentValue, value14Bit);
+            sentValue = (juce::int16) value14Bit;
+
+            // An LSB always follows its MSB, even past the end of the block
+            if ((halves & CinemixCodec::sendMsb) != 0)
+                addToBlock(hostOutput, messages, 3, 0.0, numSamples);
+
+            if ((halves & CinemixCodec::sendLsb) != 0)
+                addToBlock(hostOutput, messages + 3, 3, 0.0, numSamples, true);
+        }
+        else
+        {
+            const juce::uint8 message[3] = { (juce::uint8) status, (juce::uint8) ccNumber, (juce::uint8) (encoded & 0x7F) };
+            addToBlock(hostOutput, message, 3, 0.0, numSamples);
+        }
+    }
+
+    lineFreeAtSample = juce::jmax(0.0, lineFreeAtSample - numSamples);
+}
+
+bool HostMidiTransport::addToBlock(juce::MidiBuffer& hostOutput, const juce::uint8* data, int size,
+                                   double position, int numSamples, bool canOverrun)
+{
+    // Never put a message on the wire before the previous one has left it
+    position = juce::jmax(position, lineFreeAtSample, 0.0);
+
+    if (position >= numSamples)
+    {
+        if (!canOverrun)
+            return false;
+
+        position = numSamples - 1;
+    }
+
+    PipelineTrace::midi(PipelineTrace::Stage::wireWrite, data, size);
+    hostOutput.addEvent(data, size, (int) position);
+    lineFreeAtSample = position + size * currentSampleRate / bytesPerSecond;
+    return true;
+}
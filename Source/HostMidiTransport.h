@@ -0,0 +1,146 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - HostMidiTransport.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "ConsoleTransport.h"
+#include "MpscQueue.h"
+#include "RcuPointer.h"
+
+//==============================================================================
+/**
+ * HostMidiTransport
+ *
+ * ConsoleTransport over the plugin's own MIDI bus: the host carries the
+ * console traffic, so no devices are opened and no threads are started.
+ * Useful in hosts that already own the console's ports.
+ *
+ * The host bus is a single cable, so the console's two ports share it by
+ * channel: port 1 on channels 1-8 as they are, port 2 moved up to
+ * channels 9-16 (its channels 2, 4 and 5 become 10, 12 and 13). Route
+ * each half to the matching console port in the host. Controls mapped to
+ * channels above 8 can't be carried and are dropped.
+ *
+ * Output is queued lock-free from any thread, just like MidiPortHub, and
+ * written into the block by renderBlock():
+ * - Ordered messages first, in order. Blocks from sendBlock() keep their
+ *   sample positions, so automation queued during processBlock lands
+ *   sample-accurately in the same block.
+ * - Then the latest value of every control that changed (coalesced per CC),
+ *   and of a fader's MSB/LSB pair only the half that changed.
+ * Messages are spaced at the 31.25 kbaud wire rate; whatever doesn't fit
+ * into a block waits for the next one.
+ *
+ * Input: receiveBlock() hands each console message on the plugin's MIDI
+ * input to the clients, the same way a device callback would.
+ *
+ * renderBlock() and receiveBlock() must only be called from processBlock.
+ */
+class HostMidiTransport : public ConsoleTransport
+{
+public:
+    //==============================================================================
+    HostMidiTransport();
+    ~HostMidiTransport() override;
+
+    /** Sets the rate used for wire pacing and due times */
+    void prepare(double sampleRate);
+
+    /** Decodes console input from the host's MIDI for this block */
+    void receiveBlock(const juce::MidiBuffer& hostInput);
+
+    /** Writes the console traffic due in this block into the host's MIDI output */
+    void renderBlock(juce::MidiBuffer& hostOutput, int numSamples);
+
+    //==============================================================================
+    void addClient(Client* client) override;
+    void removeClient(Client* client) override;
+
+    juce::Array<juce::MidiDeviceInfo> getAvailableInputs() const override;
+    juce::Array<juce::MidiDeviceInfo> getAvailableOutputs() const override;
+
+    bool openPorts(Client* client, int inPort1Index, int inPort2Index,
+                   int outPort1Index, int outPort2Index) override;
+    void releasePorts(Client* client) override;
+    bool areOutputsOpen() const override;
+    juce::String getPortStatusString() const override;
+
+    bool isConsoleLive() const override         { return consoleLive.load(); }
+    void setConsoleLive(bool isLive) override   { consoleLive = isLive; }
+
+    //==============================================================================
+    void sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs = 0.0) override;
+    void sendBlock(int portIndex, const juce::MidiBuffer& buffer, double startTimeMs, double sampleRate) override;
+    void sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value) override;
+    void sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit) override;
+    void forgetSentFaderValues() override       { faderValuesUnknown = true; }
+
+    /** Both ports share one bus and so one set of queues: each reports the total */
+    QueueStats getQueueStats(int portIndex) const override;
+
+private:
+    //==============================================================================
+    static constexpr int numPorts = 2;
+    static constexpr int channelsPerPort = 8;
+
+    // MIDI 1.0 wire rate: 31250 baud, 10 bits per byte
+    static constexpr double bytesPerSecond = 3125.0;
+
+    struct OrderedMessage
+    {
+        double dueTimeMs = 0.0;     // 0 = at samplePosition in the next block
+        int samplePosition = 0;
+        juce::uint8 data[3] {};
+        juce::uint8 size = 0;
+    };
+
+    RcuPointer<juce::Array<Client*>> clients { std::make_unique<juce::Array<Client*>>() };
+    juce::CriticalSection clientLock;
+
+    std::atomic<bool> consoleLive { false };
+
+    // Pending coalesced value per (port, channel, CC); 0 = nothing waiting.
+    // Bit 31 marks a value, bit 21 a fader pair, bits 14-20 the LSB CC
+    std::array<std::atomic<juce::uint32>, numPorts * 16 * 128> pendingValues {};
+    MpscQueue<juce::uint16, numPorts * 16 * 128> pendingKeys;
+    MpscQueue<OrderedMessage, 1024> ordered;
+    std::atomic<int> queueHighWater { 0 };
+    std::atomic<bool> faderValuesUnknown { true };      // Set from any thread: sentFaderValues are out of date
+
+    // Audio thread only
+    double currentSampleRate = 44100.0;
+    double lineFreeAtSample = 0.0;      // When the last message has left the wire, from this block's start
+    OrderedMessage heldMessage;
+    bool hasHeldMessage = false;
+    std::array<juce::int16, numPorts * 16 * 128> sentFaderValues {};   // Per MSB (port, channel, CC); -1 = unknown
+
+    /** Host channel for a console port's channel, or 0 if it can't be carried */
+    static int toHostChannel(int portIndex, int midiChannel) noexcept;
+
+    bool queue(int portIndex, const juce::uint8* data, int size, double dueTimeMs, int samplePosition);
+    void updateHighWater() noexcept;
+
+    /**
+     * Adds a message at the first free point on the wire; false if that's past
+     * the block, unless canOverrun (a fader's LSB, which must follow its MSB)
+     */
+    bool addToBlock(juce::MidiBuffer& hostOutput, const juce::uint8* data, int size,
+                    double position, int numSamples, bool canOverrun = false);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (HostMidiTransport)
+};
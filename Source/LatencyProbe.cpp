@@ -0,0 +1,220 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - LatencyProbe.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "LatencyProbe.h"
+#include "ConsoleCodec.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr int defaultNumChannels = 8;
+    constexpr int numHistogramBins = 10;
+    constexpr int histogramWidth = 40;
+
+    std::vector<double> getSortedLatencies(const juce::Array<LatencyProbe::Sample>& samples, int channel = -1)
+    {
+        std::vector<double> latencies;
+
+        for (const auto& sample : samples)
+            if (channel < 0 || sample.channel == channel)
+                latencies.push_back(sample.latencyMs);
+
+        std::sort(latencies.begin(), latencies.end());
+        return latencies;
+    }
+
+    /** Nearest-rank percentile of sorted values */
+    double getPercentileOf(const std::vector<double>& sorted, double percent)
+    {
+        if (sorted.empty())
+            return 0.0;
+
+        auto rank = (int) std::ceil(juce::jlimit(0.0, 100.0, percent) / 100.0 * (double) sorted.size());
+        return sorted[(size_t) juce::jlimit(0, (int) sorted.size() - 1, rank - 1)];
+    }
+
+    juce::String formatMs(double ms)
+    {
+        return juce::String(ms, 3) + " ms";
+    }
+}
+
+//==============================================================================
+LatencyProbe::LatencyProbe(MidiRouter& routerToUse)
+    : router(routerToUse)
+{
+    router.onParameterChangeFromConsole = [this](int paramIndex, float value, double timeMs)
+    {
+        handleConsoleValue(paramIndex, value, timeMs);
+    };
+}
+
+//==============================================================================
+LatencyProbe::Result LatencyProbe::measure(const Settings& settings, std::function<bool()> shouldStop)
+{
+    Result result;
+    juce::Array<int> channels;
+
+    for (auto channel : settings.channels)
+        if (juce::isPositiveAndBelow(channel, CinemixConsole::numChannels)
+            && router.ownsParameter(CinemixConsole::upperFaderIndex(channel)))
+            channels.addIfNotAlreadyThere(channel);
+
+    if (settings.channels.isEmpty())
+        for (int channel = 0; channel < juce::jmin(defaultNumChannels, CinemixConsole::numChannels); ++channel)
+            if (router.ownsParameter(CinemixConsole::upperFaderIndex(channel)))
+                channels.add(channel);
+
+    if (channels.isEmpty())
+        return result;
+
+    toleranceSteps = juce::jmax(0, settings.toleranceSteps);
+    juce::Random random(1);
+
+    for (int move = 0; move < settings.numMoves; ++move)
+    {
+        if (shouldStop != nullptr && shouldStop())
+            break;
+
+        // Each channel swaps between the lower and upper part of the travel,
+        // so a late report of its previous move can never match the new one
+        auto channel = channels[move % channels.size()];
+        auto paramIndex = CinemixConsole::upperFaderIndex(channel);
+        auto isUpper = (move / channels.size()) % 2 == 0;
+        auto value = (isUpper ? 0.7f : 0.2f) + 0.1f * random.nextFloat();
+
+        arrived.reset();
+        targetValue = CinemixCodec::encodeValue(CinemixConsole::Kind::fader, -1, value);
+        targetParameter = paramIndex;
+
+        auto sentMs = juce::Time::getMillisecondCounterHiRes();
+        router.sendParameterUpdate(paramIndex, value);
+
+        if (arrived.wait(settings.timeoutMs))
+            result.samples.add({ channel, arrivalTimeMs.load() - sentMs });
+        else
+            ++result.numTimeouts;
+
+        targetParameter = -1;
+
+        if (settings.settleMs > 0.0)
+            juce::Thread::sleep(juce::roundToInt(settings.settleMs));
+    }
+
+    return result;
+}
+
+void LatencyProbe::handleConsoleValue(int paramIndex, float value, double timeMs)
+{
+    auto target = targetParameter.load();
+
+    if (paramIndex != target || target < 0)
+        return;
+
+    auto position = CinemixCodec::encodeValue(CinemixConsole::Kind::fader, -1, value);
+
+    if (std::abs(position - targetValue.load()) > toleranceSteps.load())
+        return;
+
+    // Only the first report near the target counts
+    if (targetParameter.compare_exchange_strong(target, -1))
+    {
+        arrivalTimeMs = timeMs;
+        arrived.signal();
+    }
+}
+
+//==============================================================================
+// Result
+
+double LatencyProbe::Result::getPercentile(double percent) const
+{
+    return getPercentileOf(getSortedLatencies(samples), percent);
+}
+
+double LatencyProbe::Result::getMean() const
+{
+    if (samples.isEmpty())
+        return 0.0;
+
+    double total = 0.0;
+
+    for (const auto& sample : samples)
+        total += sample.latencyMs;
+
+    return total / samples.size();
+}
+
+double LatencyProbe::Result::getStandardDeviation() const
+{
+    if (samples.size() < 2)
+        return 0.0;
+
+    auto mean = getMean();
+    double sumOfSquares = 0.0;
+
+    for (const auto& sample : samples)
+        sumOfSquares += (sample.latencyMs - mean) * (sample.latencyMs - mean);
+
+    return std::sqrt(sumOfSquares / (samples.size() - 1));
+}
+
+juce::String LatencyProbe::Result::createReport() const
+{
+    juce::String report;
+    report << samples.size() << " moves measured, " << numTimeouts << " not reported in time\n";
+
+    if (samples.isEmpty())
+        return report;
+
+    auto sorted = getSortedLatencies(samples);
+    auto minimum = sorted.front(), maximum = sorted.back();
+
+    report << "Min " << formatMs(minimum) << ", median " << formatMs(getPercentileOf(sorted, 50.0))
+           << ", mean " << formatMs(getMean()) << ", std dev " << formatMs(getStandardDeviation()) << "\n"
+           << "P95 " << formatMs(getPercentileOf(sorted, 95.0)) << ", P99 " << formatMs(getPercentileOf(sorted, 99.0))
+           << ", max " << formatMs(maximum) << "\n\n";
+
+    // Histogram over the measured range
+    std::array<int, numHistogramBins> bins {};
+    auto binWidth = juce::jmax(0.001, (maximum - minimum) / numHistogramBins);
+
+    for (auto latency : sorted)
+        ++bins[(size_t) juce::jlimit(0, numHistogramBins - 1, (int) ((latency - minimum) / binWidth))];
+
+    auto largestBin = *std::max_element(bins.begin(), bins.end());
+
+    for (int i = 0; i < numHistogramBins; ++i)
+    {
+        auto barLength = bins[(size_t) i] * histogramWidth / juce::jmax(1, largestBin);
+
+        report << juce::String(minimum + i * binWidth, 3).paddedLeft(' ', 10) << " ms | "
+               << juce::String::repeatedString("#", barLength) << " " << bins[(size_t) i] << "\n";
+    }
+
+    report << "\n";
+
+    for (int channel = 0; channel < CinemixConsole::numChannels; ++channel)
+    {
+        auto perChannel = getSortedLatencies(samples, channel);
+
+        if (!perChannel.empty())
+            report << "Channel " << (channel + 1) << ": median " << formatMs(getPercentileOf(perChannel, 50.0))
+                   << " over " << (int) perChannel.size() << " moves\n";
+    }
+
+    return report;
+}
@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - LatencyProbe.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include "MidiRouter.h"
+
+//==============================================================================
+/**
+ * LatencyProbe
+ *
+ * Measures the real round trip to the console: a fader is sent to a known
+ * 14-bit position with MidiRouter::sendParameterUpdate(), and the time is
+ * taken from the send until the console reports the fader at that position
+ * on its input. That covers the router's queues, the MIDI interface both
+ * ways, the console's firmware and the motor, which is what the host's
+ * latency compensation has to make up for.
+ *
+ * The moves alternate between the lower and upper part of the fader's
+ * travel, with a little randomness, across the chosen channels, so every
+ * sample is a real motor move rather than a repeat the router would skip.
+ * With a LoopbackTransport in place of the console the same measurement
+ * runs without hardware and only measures the bridge's own share.
+ *
+ * The probe takes over the router's onParameterChangeFromConsole, so it
+ * must be created before the router's ports are opened and deleted after
+ * the router, and the router must not be driven by anything else (a
+ * processor) while measuring.
+ */
+class LatencyProbe
+{
+public:
+    //==============================================================================
+    struct Settings
+    {
+        int numMoves = 200;
+        juce::Array<int> channels;      // Console channels (0-based) whose upper faders move; empty = 1-8
+        int toleranceSteps = 128;       // How near (in 14-bit steps) the reported position must be
+        double timeoutMs = 2000.0;      // A move not reported by then counts as lost
+        double settleMs = 50.0;         // Pause between moves, so the motors come to rest
+    };
+
+    struct Sample
+    {
+        int channel = 0;
+        double latencyMs = 0.0;
+    };
+
+    struct Result
+    {
+        juce::Array<Sample> samples;    // In the order measured
+        int numTimeouts = 0;
+
+        /** Latency at a percentile (0-100) of all samples, or 0 with none */
+        double getPercentile(double percent) const;
+
+        double getMean() const;
+        double getStandardDeviation() const;
+
+        /** Summary, a histogram and the median per channel, for printing */
+        juce::String createReport() const;
+    };
+
+    //==============================================================================
+    explicit LatencyProbe(MidiRouter& routerToUse);
+
+    /**
+     * Makes the moves and waits for each one; blocks for the whole run.
+     * shouldStop, if given, is checked between moves.
+     */
+    Result measure(const Settings& settings, std::function<bool()> shouldStop = nullptr);
+
+private:
+    //==============================================================================
+    MidiRouter& router;
+
+    // The move being waited for (set before sending, read on the MIDI thread)
+    std::atomic<int> targetParameter { -1 };
+    std::atomic<int> targetValue { 0 };
+    std::atomic<int> toleranceSteps { 128 };
+    std::atomic<double> arrivalTimeMs { 0.0 };
+    juce::WaitableEvent arrived;
+
+    // timeMs is the device's arrival time, so dispatch doesn't count
+    void handleConsoleValue(int paramIndex, float value, double timeMs);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LatencyProbe)
+};
@@ -0,0 +1,178 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - LoopbackTransport.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "LoopbackTransport.h"
+
+//==============================================================================
+LoopbackTransport::LoopbackTransport(double echoDelayMs, double echoJitterMs)
+    : juce::Thread("Cinemix Loopback"),
+      delayMs(juce::jmax(0.0, echoDelayMs)),
+      jitterMs(juce::jmax(0.0, echoJitterMs))
+{
+    waiting.reserve(4096);
+    startThread(juce::Thread::Priority::high);
+}
+
+LoopbackTransport::~LoopbackTransport()
+{
+    stopThread(1000);
+}
+
+//==============================================================================
+// Clients
+
+void LoopbackTransport::addClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->addIfNotAlreadyThere(client);
+    clients.update(std::move(updated));
+}
+
+void LoopbackTransport::removeClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->removeFirstMatchingValue(client);
+
+    // Returns once no echo can still be inside the client
+    clients.update(std::move(updated));
+}
+
+//==============================================================================
+// Devices (none)
+
+juce::Array<juce::MidiDeviceInfo> LoopbackTransport::getAvailableInputs() const
+{
+    return {};
+}
+
+juce::Array<juce::MidiDeviceInfo> LoopbackTransport::getAvailableOutputs() const
+{
+    return {};
+}
+
+bool LoopbackTransport::openPorts(Client*, int, int, int, int)
+{
+    return true;
+}
+
+void LoopbackTransport::releasePorts(Client*)
+{
+}
+
+bool LoopbackTransport::areOutputsOpen() const
+{
+    return true;
+}
+
+juce::String LoopbackTransport::getPortStatusString() const
+{
+    return "Loopback (no console)\n"
+           "Echo after " + juce::String(delayMs, 1) + " ms"
+           + (jitterMs > 0.0 ? " + up to " + juce::String(jitterMs, 1) + " ms" : juce::String());
+}
+
+//==============================================================================
+// Output (any thread)
+
+void LoopbackTransport::sendOrdered(int, const juce::MidiMessage&, double)
+{
+}
+
+void LoopbackTransport::sendBlock(int, const juce::MidiBuffer&, double, double)
+{
+}
+
+void LoopbackTransport::sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value)
+{
+    const juce::uint8 data[] = { (juce::uint8) (0xB0 | ((midiChannel - 1) & 0x0F)),
+                                 (juce::uint8) (ccNumber & 0x7F), (juce::uint8) (value & 0x7F) };
+
+    queueEcho(portIndex, data, 3);
+}
+
+void LoopbackTransport::sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit)
+{
+    auto status = (juce::uint8) (0xB0 | ((midiChannel - 1) & 0x0F));
+    const juce::uint8 data[] = { status, (juce::uint8) (msbCcNumber & 0x7F), (juce::uint8) ((value14Bit >> 7) & 0x7F),
+                                 status, (juce::uint8) (lsbCcNumber & 0x7F), (juce::uint8) (value14Bit & 0x7F) };
+
+    queueEcho(portIndex, data, 6);
+}
+
+void LoopbackTransport::queueEcho(int portIndex, const juce::uint8* data, int size)
+{
+    if (portIndex < 1 || portIndex > numPorts)
+        return;
+
+    Echo echo;
+    echo.dueTimeMs = juce::Time::getMillisecondCounterHiRes() + delayMs;
+    echo.portIndex = portIndex;
+    echo.size = (juce::uint8) size;
+    std::memcpy(echo.data, data, (size_t) size);
+
+    // A full queue drops the echo, as an overrun console input would
+    sent.push(echo);
+}
+
+//==============================================================================
+// Loopback Thread
+
+void LoopbackTransport::run()
+{
+    while (!threadShouldExit())
+    {
+        Echo echo;
+
+        while (sent.pop(echo))
+        {
+            // Jitter per value, so a fader's MSB and LSB stay together
+            echo.dueTimeMs += jitterMs * random.nextDouble();
+            waiting.push_back(echo);
+        }
+
+        auto nowMs = juce::Time::getMillisecondCounterHiRes();
+
+        // Let go of the client list before waiting, so removeClient() needn't wait too
+        {
+            auto list = clients.read();
+
+            for (auto it = waiting.begin(); it != waiting.end();)
+            {
+                if (it->dueTimeMs > nowMs)
+                {
+                    ++it;
+                    continue;
+                }
+
+                for (int offset = 0; offset < it->size; offset += 3)
+                {
+                    juce::MidiMessage message(it->data + offset, 3, nowMs * 0.001);
+
+                    for (auto* client : *list)
+                        client->handleConsoleMessage(it->portIndex, message);
+
+                    ++numEchoed;
+                }
+
+                it = waiting.erase(it);
+            }
+        }
+
+        wait(1);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - LoopbackTransport.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <vector>
+#include "ConsoleTransport.h"
+#include "MpscQueue.h"
+#include "RcuPointer.h"
+
+//==============================================================================
+/**
+ * LoopbackTransport
+ *
+ * A stand-in for the console that needs no devices: every controller value
+ * and fader pair sent to it comes back on the same port, channel and CC
+ * after a set delay (plus optional random jitter), the way the console
+ * reports a motor fader arriving at its new position. Ordered messages and
+ * blocks (commands, AUX mutes, automation) aren't echoed.
+ *
+ * Used by LatencyProbe where there's no console, e.g. on a build machine.
+ *
+ * Sends are lock-free from any thread. Echoes are delivered to the clients
+ * on the transport's own thread, like a MIDI input callback, with about a
+ * millisecond of scheduling granularity.
+ */
+class LoopbackTransport : public ConsoleTransport,
+                          private juce::Thread
+{
+public:
+    //==============================================================================
+    explicit LoopbackTransport(double echoDelayMs = 0.0, double echoJitterMs = 0.0);
+    ~LoopbackTransport() override;
+
+    /** Number of messages sent back to the clients so far */
+    juce::int64 getNumEchoed() const noexcept   { return numEchoed.load(); }
+
+    //==============================================================================
+    void addClient(Client* client) override;
+    void removeClient(Client* client) override;
+
+    juce::Array<juce::MidiDeviceInfo> getAvailableInputs() const override;
+    juce::Array<juce::MidiDeviceInfo> getAvailableOutputs() const override;
+
+    bool openPorts(Client* client, int inPort1Index, int inPort2Index,
+                   int outPort1Index, int outPort2Index) override;
+    void releasePorts(Client* client) override;
+    bool areOutputsOpen() const override;
+    juce::String getPortStatusString() const override;
+
+    bool isConsoleLive() const override         { return consoleLive.load(); }
+    void setConsoleLive(bool isLive) override   { consoleLive = isLive; }
+
+    //==============================================================================
+    void sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs = 0.0) override;
+    void sendBlock(int portIndex, const juce::MidiBuffer& buffer, double startTimeMs, double sampleRate) override;
+    void sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value) override;
+    void sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit) override;
+
+private:
+    //==============================================================================
+    static constexpr int numPorts = 2;
+
+    // One value as the console would report it: a controller, or a fader's MSB and LSB
+    struct Echo
+    {
+        double dueTimeMs = 0.0;
+        int portIndex = 1;
+        juce::uint8 data[6] {};
+        juce::uint8 size = 0;
+    };
+
+    const double delayMs, jitterMs;
+
+    RcuPointer<juce::Array<Client*>> clients { std::make_unique<juce::Array<Client*>>() };
+    juce::CriticalSection clientLock;
+
+    std::atomic<bool> consoleLive { false };
+    std::atomic<juce::int64> numEchoed { 0 };
+
+    MpscQueue<Echo, 4096> sent;
+
+    // Loopback thread only
+    std::vector<Echo> waiting;
+    juce::Random random;
+
+    void queueEcho(int portIndex, const juce::uint8* data, int size);
+
+    void run() override;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LoopbackTransport)
+};
@@ -0,0 +1,352 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiFileStreamReader.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "MidiFileStreamReader.h"
+
+//==============================================================================
+MidiFileStreamReader::MidiFileStreamReader()
+{
+}
+
+MidiFileStreamReader::~MidiFileStreamReader()
+{
+}
+
+bool MidiFileStreamReader::open(const juce::File& midiFile)
+{
+    tracks.clear();
+    buffers.clear();
+    checkpoints.clear();
+    timing = {};
+
+    input = std::make_unique<juce::FileInputStream>(midiFile);
+    if (input->failedToOpen())
+    {
+        input.reset();
+        return false;
+    }
+
+    // Header chunk: "MThd", length 6, format, number of tracks, division
+    char chunkType[4];
+    if (input->read(chunkType, 4) != 4 || std::memcmp(chunkType, "MThd", 4) != 0)
+        return false;
+
+    auto headerLength = input->readIntBigEndian();
+    input->readShortBigEndian();  // Format - type 0 and type 1 are both just merged
+    auto numTracks = (int) (juce::uint16) input->readShortBigEndian();
+    auto division = (juce::uint16) input->readShortBigEndian();
+    input->setPosition(8 + headerLength);
+
+    if ((division & 0x8000) != 0)
+    {
+        // SMPTE: negative frames per second in the high byte, ticks per frame in the low byte
+        auto framesPerSecond = -(int) (juce::int8) (division >> 8);
+        smpteTicksPerSecond = (framesPerSecond == 29 ? 29.97 : (double) framesPerSecond) * (division & 0xFF);
+        ticksPerQuarterNote = 0;
+        timing.secondsPerTick = 1.0 / juce::jmax(1.0, smpteTicksPerSecond);
+    }
+    else
+    {
+        ticksPerQuarterNote = juce::jmax(1, (int) division);
+        timing.secondsPerTick = 0.5 / ticksPerQuarterNote;  // 120 BPM until a tempo event says otherwise
+    }
+
+    // Index the track chunks (unknown chunk types are skipped)
+    auto totalLength = input->getTotalLength();
+    while ((int) tracks.size() < juce::jmin(numTracks, maxTracks) && input->getPosition() + 8 <= totalLength)
+    {
+        if (input->read(chunkType, 4) != 4)
+            break;
+
+        auto chunkLength = (juce::int64) (juce::uint32) input->readIntBigEndian();
+        auto chunkStart = input->getPosition();
+
+        if (std::memcmp(chunkType, "MTrk", 4) == 0)
+        {
+            TrackState track;
+            track.offset = chunkStart;
+            track.chunkEnd = juce::jmin(chunkStart + chunkLength, totalLength);
+            tracks.push_back(track);
+        }
+
+        input->setPosition(chunkStart + chunkLength);
+    }
+
+    if (tracks.empty())
+        return false;
+
+    buffers.resize(tracks.size());
+
+    for (int i = 0; i < (int) tracks.size(); ++i)
+        parsePendingEvent(i);
+
+    checkpoints.push_back({ timing, tracks });
+    return true;
+}
+
+//==============================================================================
+// Merged Reading
+
+bool MidiFileStreamReader::readNext(Event& event)
+{
+    for (;;)
+    {
+        // Pick the track whose pending event comes first (lowest index wins ties,
+        // so tempo changes in the conductor track apply before same-tick events)
+        int next = -1;
+        for (int i = 0; i < (int) tracks.size(); ++i)
+            if (!tracks[(size_t) i].finished && (next < 0 || tracks[(size_t) i].tick < tracks[(size_t) next].tick))
+                next = i;
+
+        if (next < 0)
+            return false;
+
+        auto& track = tracks[(size_t) next];
+        double eventSeconds = timing.baseSeconds + (double) (track.tick - timing.baseTick) * timing.secondsPerTick;
+
+        if (track.pendingIsTempo)
+        {
+            // Tempo only affects PPQ files; SMPTE timing is absolute
+            if (ticksPerQuarterNote > 0)
+            {
+                timing.baseTick = track.tick;
+                timing.baseSeconds = eventSeconds;
+                timing.secondsPerTick = (track.pendingTempo / 1.0e6) / ticksPerQuarterNote;
+            }
+
+            parsePendingEvent(next);
+            continue;
+        }
+
+        event.timeSeconds = eventSeconds;
+        event.numBytes = track.pendingSize;
+        std::memcpy(event.data, track.pendingData, sizeof(event.data));
+
+        if (track.portIndex > 0)
+            event.portIndex = track.portIndex;
+        else
+        {
+            auto channel = (event.data[0] & 0x0F) + 1;
+            event.portIndex = (channel == 1 || channel == 3) ? 1 : 2;
+        }
+
+        timing.lastEventSeconds = eventSeconds;
+        parsePendingEvent(next);
+        addCheckpointIfDue();
+        return true;
+    }
+}
+
+void MidiFileStreamReader::locate(double timeSeconds)
+{
+    if (checkpoints.empty())
+        return;
+
+    // Last checkpoint at or before the target
+    auto it = std::upper_bound(checkpoints.begin(), checkpoints.end(), timeSeconds,
+                               [](double time, const Checkpoint& checkpoint)
+                               {
+                                   return time < checkpoint.timing.lastEventSeconds;
+                               });
+
+    const auto& checkpoint = (it == checkpoints.begin()) ? checkpoints.front() : *std::prev(it);
+
+    timing = checkpoint.timing;
+    tracks = checkpoint.tracks;
+
+    // Buffered bytes may belong to a different part of the file now
+    for (auto& buffer : buffers)
+        buffer.size = 0;
+}
+
+void MidiFileStreamReader::addCheckpointIfDue()
+{
+    // Only extends the index forwards; re-reading known territory adds nothing
+    if (timing.lastEventSeconds >= checkpoints.back().timing.lastEventSeconds + checkpointIntervalSeconds)
+        checkpoints.push_back({ timing, tracks });
+}
+
+//==============================================================================
+// Track Parsing
+
+void MidiFileStreamReader::parsePendingEvent(int trackIndex)
+{
+    auto& track = tracks[(size_t) trackIndex];
+
+    while (!track.finished)
+    {
+        juce::uint32 delta;
+        juce::uint8 statusByte;
+
+        if (!readVariableLength(trackIndex, delta) || !readByte(trackIndex, statusByte))
+        {
+            track.finished = true;
+            return;
+        }
+
+        track.tick += delta;
+
+        juce::uint8 firstData = 0;
+        bool haveFirstData = false;
+
+        if (statusByte < 0x80)
+        {
+            // Running status: this byte is already the first data byte
+            if (track.runningStatus == 0)
+                continue;
+
+            firstData = statusByte;
+            haveFirstData = true;
+            statusByte = track.runningStatus;
+        }
+
+        if (statusByte == 0xFF)
+        {
+            // Meta event
+            juce::uint8 type;
+            juce::uint32 length;
+            if (!readByte(trackIndex, type) || !readVariableLength(trackIndex, length))
+            {
+                track.finished = true;
+                return;
+            }
+
+            track.runningStatus = 0;
+
+            juce::uint8 metaData[3] = {};
+            for (juce::uint32 i = 0; i < length; ++i)
+            {
+                juce::uint8 byte;
+                if (!readByte(trackIndex, byte))
+                {
+                    track.finished = true;
+                    return;
+                }
+
+                if (i < 3)
+                    metaData[i] = byte;
+            }
+
+            if (type == 0x2F)  // End of track
+            {
+                track.finished = true;
+                return;
+            }
+
+            if (type == 0x21 && length >= 1)  // MIDI port
+                track.portIndex = (metaData[0] % 2) + 1;
+
+            if (type == 0x51 && length >= 3)  // Tempo
+            {
+                track.pendingIsTempo = true;
+                track.pendingTempo = ((juce::uint32) metaData[0] << 16)
+                                   | ((juce::uint32) metaData[1] << 8)
+                                   | metaData[2];
+                return;
+            }
+
+            continue;
+        }
+
+        if (statusByte == 0xF0 || statusByte == 0xF7)
+        {
+            // SysEx - skipped
+            juce::uint32 length;
+            juce::uint8 byte;
+            if (!readVariableLength(trackIndex, length))
+            {
+                track.finished = true;
+                return;
+            }
+
+            for (juce::uint32 i = 0; i < length; ++i)
+                if (!readByte(trackIndex, byte))
+                    break;
+
+            track.runningStatus = 0;
+            continue;
+        }
+
+        // Channel voice message
+        track.runningStatus = statusByte;
+        auto type = statusByte & 0xF0;
+        int numDataBytes = (type == 0xC0 || type == 0xD0) ? 1 : 2;
+
+        track.pendingIsTempo = false;
+        track.pendingData[0] = statusByte;
+        track.pendingSize = 1 + numDataBytes;
+
+        for (int i = 0; i < numDataBytes; ++i)
+        {
+            if (i == 0 && haveFirstData)
+            {
+                track.pendingData[1] = firstData;
+                continue;
+            }
+
+            if (!readByte(trackIndex, track.pendingData[1 + i]))
+            {
+                track.finished = true;
+                return;
+            }
+        }
+
+        return;
+    }
+}
+
+bool MidiFileStreamReader::readByte(int trackIndex, juce::uint8& byte)
+{
+    auto& track = tracks[(size_t) trackIndex];
+    auto& buffer = buffers[(size_t) trackIndex];
+
+    if (track.offset >= track.chunkEnd)
+        return false;
+
+    // Refill this track's buffer when the next byte isn't in it
+    if (track.offset < buffer.start || track.offset >= buffer.start + buffer.size)
+    {
+        auto bytesToRead = (int) juce::jmin((juce::int64) trackBufferSize, track.chunkEnd - track.offset);
+
+        input->setPosition(track.offset);
+        buffer.start = track.offset;
+        buffer.size = juce::jmax(0, input->read(buffer.data.data(), bytesToRead));
+
+        if (buffer.size == 0)
+            return false;
+    }
+
+    byte = buffer.data[(size_t) (track.offset - buffer.start)];
+    ++track.offset;
+    return true;
+}
+
+bool MidiFileStreamReader::readVariableLength(int trackIndex, juce::uint32& value)
+{
+    value = 0;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        juce::uint8 byte;
+        if (!readByte(trackIndex, byte))
+            return false;
+
+        value = (value << 7) | (byte & 0x7F);
+
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+
+    return false;
+}
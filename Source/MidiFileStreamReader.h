@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiFileStreamReader.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <vector>
+
+//==============================================================================
+/**
+ * MidiFileStreamReader
+ *
+ * Reads channel messages from a standard MIDI file in time order without
+ * loading it into memory (unlike juce::MidiFile). Each track is read through
+ * its own small buffer and the tracks are merged on the fly, applying tempo
+ * changes as they are reached.
+ *
+ * While reading, the reader drops a checkpoint (the complete parser state,
+ * a few bytes per track) every few seconds of file time. locate() restores
+ * the closest checkpoint before the target, so seeking only ever re-reads a
+ * few seconds of the file, and memory grows by a handful of bytes per
+ * checkpoint regardless of file size.
+ *
+ * Events are assigned to a console port using the track's MIDI port meta
+ * event (FF 21) when present, otherwise by the Cinemix channel layout
+ * (channels 1 and 3 on port 1, everything else on port 2).
+ */
+class MidiFileStreamReader
+{
+public:
+    //==============================================================================
+    struct Event
+    {
+        double timeSeconds;
+        int portIndex;           // 1 or 2
+        int numBytes;            // 2 or 3
+        juce::uint8 data[3];
+    };
+
+    //==============================================================================
+    MidiFileStreamReader();
+    ~MidiFileStreamReader();
+
+    /** Opens a file and parses its header and track table. Returns false if it isn't an SMF. */
+    bool open(const juce::File& midiFile);
+
+    /** Reads the next channel message in time order. Returns false at the end of the file. */
+    bool readNext(Event& event);
+
+    /**
+     * Positions the reader at or shortly before the given time. The caller
+     * skips any events earlier than the target.
+     */
+    void locate(double timeSeconds);
+
+    int getNumTracks() const { return (int) tracks.size(); }
+
+private:
+    //==============================================================================
+    static constexpr int maxTracks = 64;
+    static constexpr int trackBufferSize = 2048;
+    static constexpr double checkpointIntervalSeconds = 5.0;
+
+    // Everything needed to resume parsing a track - small and copyable
+    struct TrackState
+    {
+        juce::int64 offset = 0;          // Next byte to parse
+        juce::int64 chunkEnd = 0;
+        juce::int64 tick = 0;            // Absolute tick of the pending event
+        int portIndex = 0;               // 0 = not set by a port meta event
+        juce::uint8 runningStatus = 0;
+        bool finished = false;
+
+        // The next event of this track, parsed but not yet merged
+        bool pendingIsTempo = false;
+        int pendingSize = 0;
+        juce::uint8 pendingData[3] = {};
+        juce::uint32 pendingTempo = 0;
+    };
+
+    struct TimingState
+    {
+        juce::int64 baseTick = 0;        // Tick of the last tempo change
+        double baseSeconds = 0.0;        // Time of the last tempo change
+        double secondsPerTick = 0.0;
+        double lastEventSeconds = 0.0;
+    };
+
+    struct Checkpoint
+    {
+        TimingState timing;
+        std::vector<TrackState> tracks;
+    };
+
+    struct TrackBuffer
+    {
+        std::array<juce::uint8, trackBufferSize> data;
+        juce::int64 start = 0;
+        int size = 0;
+    };
+
+    //==============================================================================
+    std::unique_ptr<juce::FileInputStream> input;
+    std::vector<TrackState> tracks;
+    std::vector<TrackBuffer> buffers;
+    std::vector<Checkpoint> checkpoints;
+    TimingState timing;
+
+    int ticksPerQuarterNote = 0;         // 0 for SMPTE files
+    double smpteTicksPerSecond = 0.0;
+
+    bool readByte(int track, juce::uint8& byte);
+    bool readVariableLength(int track, juce::uint32& value);
+    void parsePendingEvent(int track);
+    void addCheckpointIfDue();
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiFileStreamReader)
+};
@@ -0,0 +1,312 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiMappingTable.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "MidiMappingTable.h"
+
+//==============================================================================
+constexpr MidiMappingTable::MidiMappingTable(BuiltInLayout)
+{
+    // What compile() produces for the built-in layout, worked out by the compiler
+    auto mappings = Layout::createMappings();
+    auto reverseMappings = Layout::createReverseMappings();
+
+    for (int i = 0; i < Layout::totalParameters; ++i)
+    {
+        auto& entry = entries[(size_t) i];
+        entry.midi = mappings[(size_t) i];
+        entry.auxSlot = (juce::int8) ((entry.midi.kind == Kind::auxMute) ? i - Layout::auxMuteStart : -1);
+        entry.isMapped = true;
+
+        if (entry.midi.isFader())
+            inputs[(size_t) Layout::reverseIndex(entry.midi.portIndex, entry.midi.midiChannel, entry.midi.ccNumber2)]
+                = { (juce::int16) i, InputSource::faderLsb };
+    }
+
+    for (size_t key = 0; key < reverseMappings.size(); ++key)
+    {
+        auto paramIndex = reverseMappings[key];
+        if (paramIndex < 0)
+            continue;
+
+        bool isAuxMute = mappings[(size_t) paramIndex].kind == Kind::auxMute;
+        inputs[key] = { paramIndex, isAuxMute ? InputSource::sharedAuxMute : InputSource::console };
+    }
+
+    for (int aux = 0; aux < Layout::numAuxMutes; ++aux)
+        auxSlotParameters[(size_t) aux] = (juce::int16) (Layout::auxMuteStart + aux);
+
+    updateEncoding();
+}
+
+constexpr void MidiMappingTable::updateEncoding() noexcept
+{
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const auto& entry = entries[i];
+
+        encoding.scales[i] = CinemixCodec::getScale(entry.midi.kind);
+        encoding.offsets[i] = CinemixCodec::getOffset(entry.midi.kind, entry.auxSlot);
+        encoding.isMapped[i] = entry.isMapped ? 1 : 0;
+        encoding.alwaysSend[i] = (entry.isMapped && entry.midi.kind == Kind::auxMute) ? 1 : 0;
+        encoding.isFader[i] = (entry.isMapped && entry.midi.isFader()) ? 1 : 0;
+    }
+}
+
+// Validity is checked by the static_asserts in ConsoleLayout.h
+constexpr MidiMappingTable MidiMappingTable::defaultTable { MidiMappingTable::BuiltInLayout() };
+
+const MidiMappingTable& MidiMappingTable::getDefault() noexcept
+{
+    return defaultTable;
+}
+
+std::unique_ptr<MidiMappingTable> MidiMappingTable::createDefault()
+{
+    // A copy of constant data; compile() only runs for mapping files
+    std::unique_ptr<MidiMappingTable> table(new MidiMappingTable());
+    table->entries = defaultTable.entries;
+    table->inputs = defaultTable.inputs;
+    table->auxSlotParameters = defaultTable.auxSlotParameters;
+    table->encoding = defaultTable.encoding;
+    return table;
+}
+
+juce::File MidiMappingTable::getDefaultMappingFile()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+               .getChildFile("CinemixAutomationBridge")
+               .getChildFile("Mapping.json");
+}
+
+//==============================================================================
+// Mapping Files
+
+std::unique_ptr<MidiMappingTable> MidiMappingTable::loadFromFile(const juce::File& mappingFile,
+                                                                 juce::String& errorMessage)
+{
+    auto json = juce::JSON::parse(mappingFile);
+    if (!json.isObject())
+    {
+        errorMessage = mappingFile.getFileName() + " is not a valid mapping file";
+        return nullptr;
+    }
+
+    auto table = createDefault();
+
+    auto parameterFor = [&errorMessage](const juce::var& id) -> int
+    {
+        int index = Layout::getParameterIndex(id.toString());
+        if (index < 0)
+            errorMessage = "Unknown parameter \"" + id.toString() + "\"";
+        return index;
+    };
+
+    auto sameKind = [&errorMessage, &table](int a, int b) -> bool
+    {
+        if (table->entries[(size_t) a].midi.kind == table->entries[(size_t) b].midi.kind)
+            return true;
+
+        errorMessage = Layout::getParameterID(a) + " and " + Layout::getParameterID(b)
+                     + " are different kinds of control";
+        return false;
+    };
+
+    if (auto* mappings = json["mappings"].getArray())
+    {
+        for (const auto& directive : *mappings)
+        {
+            if (auto* swap = directive["swap"].getArray())
+            {
+                if (swap->size() != 2)
+                {
+                    errorMessage = "\"swap\" needs exactly two parameters";
+                    return nullptr;
+                }
+
+                int a = parameterFor((*swap)[0]);
+                int b = parameterFor((*swap)[1]);
+                if (a < 0 || b < 0 || !sameKind(a, b))
+                    return nullptr;
+
+                std::swap(table->entries[(size_t) a], table->entries[(size_t) b]);
+                continue;
+            }
+
+            int paramIndex = parameterFor(directive["param"]);
+            if (paramIndex < 0)
+                return nullptr;
+
+            auto& entry = table->entries[(size_t) paramIndex];
+
+            if (directive.hasProperty("enabled") && !(bool) directive["enabled"])
+            {
+                entry.isMapped = false;
+            }
+            else if (directive.hasProperty("from"))
+            {
+                int source = parameterFor(directive["from"]);
+                if (source < 0 || !sameKind(paramIndex, source))
+                    return nullptr;
+
+                // Always the source's built-in control, whatever earlier entries did to it
+                entry.midi = Layout::mappings[(size_t) source];
+                entry.auxSlot = (juce::int8) ((entry.midi.kind == Kind::auxMute) ? source - Layout::auxMuteStart : -1);
+                entry.isMapped = true;
+            }
+            else if (directive.hasProperty("port") && directive.hasProperty("channel") && directive.hasProperty("cc"))
+            {
+                int port = directive["port"];
+                int channel = directive["channel"];
+                int cc = directive["cc"];
+
+                // Checked here as well as in compile(): the fields are only a byte wide
+                if (port < 1 || port > 2 || channel < 1 || channel > 16 || cc < 0 || cc >= 120)
+                {
+                    errorMessage = Layout::getParameterID(paramIndex) + " has an invalid MIDI address";
+                    return nullptr;
+                }
+
+                entry.midi = { channel, cc, entry.midi.isFader() ? cc + 1 : -1, port, entry.midi.kind };
+                entry.isMapped = true;
+            }
+            else
+            {
+                errorMessage = "Mapping for " + directive["param"].toString() + " needs \"from\", an address or \"enabled\"";
+                return nullptr;
+            }
+        }
+    }
+
+    juce::Array<ExtraInput> extraInputs;
+
+    if (auto* inputList = json["inputs"].getArray())
+    {
+        for (const auto& input : *inputList)
+        {
+            int paramIndex = parameterFor(input["param"]);
+            if (paramIndex < 0)
+                return nullptr;
+
+            extraInputs.add({ paramIndex, (int) input["port"], (int) input["channel"], (int) input["cc"] });
+        }
+    }
+
+    if (!table->compile(extraInputs, errorMessage))
+        return nullptr;
+
+    return table;
+}
+
+//==============================================================================
+// Table Compilation
+
+bool MidiMappingTable::compile(const juce::Array<ExtraInput>& extraInputs, juce::String& errorMessage)
+{
+    inputs.fill({});
+    auxSlotParameters.fill(-1);
+
+    // Who uses each (port, channel, CC): -1 = free, -2 = console system CC
+    std::array<int, 2 * 16 * 128> owners;
+    owners.fill(-1);
+
+    for (int port = 1; port <= 2; ++port)
+    {
+        owners[(size_t) Layout::reverseIndex(port, 5, 65)] = -2;
+        owners[(size_t) Layout::reverseIndex(port, 5, 127)] = -2;
+
+        for (int cc = 64; cc <= 111; ++cc)
+            owners[(size_t) Layout::reverseIndex(port, port == 1 ? 3 : 4, cc)] = -2;
+    }
+
+    auto claim = [&](int paramIndex, int port, int channel, int cc) -> bool
+    {
+        if (port < 1 || port > 2 || channel < 1 || channel > 16 || cc < 0 || cc >= 120)
+        {
+            errorMessage = Layout::getParameterID(paramIndex) + " has an invalid MIDI address";
+            return false;
+        }
+
+        auto& owner = owners[(size_t) Layout::reverseIndex(port, channel, cc)];
+        if (owner != -1)
+        {
+            errorMessage = Layout::getParameterID(paramIndex) + " clashes with "
+                         + (owner == -2 ? juce::String("a console system CC") : Layout::getParameterID(owner))
+                         + " on port " + juce::String(port) + ", channel " + juce::String(channel)
+                         + ", CC " + juce::String(cc);
+            return false;
+        }
+
+        owner = paramIndex;
+        return true;
+    };
+
+    for (int i = 0; i < Layout::totalParameters; ++i)
+    {
+        const auto& entry = entries[(size_t) i];
+        if (!entry.isMapped)
+            continue;
+
+        const auto& midi = entry.midi;
+        auto key = (size_t) Layout::reverseIndex(juce::jlimit(1, 2, (int) midi.portIndex),
+                                                 juce::jlimit(1, 16, (int) midi.midiChannel),
+                                                 juce::jlimit(0, 127, (int) midi.ccNumber));
+
+        if (midi.kind == Kind::auxMute)
+        {
+            // All AUX mutes share one CC; each needs its own value pair instead
+            if (entry.auxSlot < 0 || entry.auxSlot >= Layout::numAuxMutes || auxSlotParameters[(size_t) entry.auxSlot] >= 0)
+            {
+                errorMessage = Layout::getParameterID(i) + " shares its AUX value pair with another parameter";
+                return false;
+            }
+
+            auxSlotParameters[(size_t) entry.auxSlot] = (juce::int16) i;
+
+            if (inputs[key].source == InputSource::sharedAuxMute)
+                continue;
+
+            if (!claim(i, midi.portIndex, midi.midiChannel, midi.ccNumber))
+                return false;
+
+            inputs[key] = { (juce::int16) i, InputSource::sharedAuxMute };
+            continue;
+        }
+
+        if (!claim(i, midi.portIndex, midi.midiChannel, midi.ccNumber))
+            return false;
+
+        inputs[key] = { (juce::int16) i, InputSource::console };
+
+        // Fader LSBs refine the MSB received before them (see MidiRouter)
+        if (midi.isFader())
+        {
+            if (!claim(i, midi.portIndex, midi.midiChannel, midi.ccNumber2))
+                return false;
+
+            inputs[(size_t) Layout::reverseIndex(midi.portIndex, midi.midiChannel, midi.ccNumber2)] = { (juce::int16) i, InputSource::faderLsb };
+        }
+    }
+
+    for (const auto& extra : extraInputs)
+    {
+        if (!claim(extra.paramIndex, extra.portIndex, extra.midiChannel, extra.ccNumber))
+            return false;
+
+        inputs[(size_t) Layout::reverseIndex(extra.portIndex, extra.midiChannel, extra.ccNumber)]
+            = { (juce::int16) extra.paramIndex, InputSource::extraController };
+    }
+
+    updateEncoding();
+    return true;
+}
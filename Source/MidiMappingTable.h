@@ -0,0 +1,176 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiMappingTable.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "ConsoleCodec.h"
+#include "ConsoleLayout.h"
+
+//==============================================================================
+/**
+ * MidiMappingTable
+ *
+ * The parameter <-> MIDI mapping MidiRouter actually uses: the compile-time
+ * CinemixConsole layout, optionally modified by a user mapping file. Both
+ * directions are dense arrays, so a lookup is one index either way.
+ *
+ * Tables are immutable once built; MidiRouter swaps whole tables (see
+ * RcuPointer), so a remap never blocks the MIDI threads. The built-in
+ * layout's table is generated by the compiler into read-only data and shared
+ * by every instance (getDefault()); only remaps allocate a table of their own.
+ *
+ * Mapping file (JSON):
+ * {
+ *   "mappings": [
+ *     { "param": "fader_3", "from": "fader_7" },                     // fader_3 uses fader_7's console control
+ *     { "swap": [ "fader_10", "fader_11" ] },                        // exchange two parameters' controls
+ *     { "param": "mute_5", "port": 1, "channel": 3, "cc": 40 },      // explicit address (faders use cc and cc + 1)
+ *     { "param": "fader_20", "enabled": false }                      // not sent or received
+ *   ],
+ *   "inputs": [
+ *     { "param": "master_fader", "port": 2, "channel": 7, "cc": 7 }  // extra controller, 0-127, input only
+ *   ]
+ * }
+ * Entries are applied in order, starting from the built-in layout.
+ */
+class MidiMappingTable
+{
+public:
+    //==============================================================================
+    using Layout = CinemixConsole;
+    using Kind = Layout::Kind;
+    using MidiMapping = Layout::MidiMapping;
+
+    struct Entry
+    {
+        MidiMapping midi;
+        juce::int8 auxSlot = -1;     // AUX mutes: which value pair to send (0-9)
+        bool isMapped = false;
+        juce::uint8 reserved = 0;
+    };
+
+    static_assert(sizeof(Entry) == 8, "Eight entries per cache line");
+
+    enum class InputSource : juce::uint8
+    {
+        none,
+        console,            // Decoded according to the parameter's kind
+        sharedAuxMute,      // CC#96 - the value selects the AUX mute
+        extraController,    // Plain 0-127 from an added controller
+        faderLsb            // Refines the fader's last MSB to 14 bits
+    };
+
+    struct Input
+    {
+        juce::int16 paramIndex = -1;
+        InputSource source = InputSource::none;
+    };
+
+    /**
+     * How each parameter's value is put on the wire, as one formula for every
+     * kind of control so whole parameter vectors can be encoded in a single
+     * branch-free pass (see MidiRouter::sendParameterValues):
+     *
+     *   encoded = offset + (int) (jlimit(0, 1, value) * scale)
+     *
+     * The scales and offsets come from CinemixCodec, which defines the rules.
+     */
+    struct Encoding
+    {
+        alignas(64) std::array<float, Layout::totalParameters> scales {};
+        alignas(64) std::array<juce::int32, Layout::totalParameters> offsets {};
+        std::array<juce::uint8, Layout::totalParameters> isMapped {};
+        std::array<juce::uint8, Layout::totalParameters> alwaysSend {};    // AUX mutes share a CC, so never skip them
+        std::array<juce::uint8, Layout::totalParameters> isFader {};       // 14-bit, so subject to MidiRouter::setFaderResolution()
+    };
+
+    //==============================================================================
+    /** The built-in layout: one constant table, shared by the whole process */
+    static const MidiMappingTable& getDefault() noexcept;
+
+    /** A modifiable copy of the built-in layout */
+    static std::unique_ptr<MidiMappingTable> createDefault();
+
+    /** Builds a table from a mapping file; returns nullptr and sets errorMessage on failure */
+    static std::unique_ptr<MidiMappingTable> loadFromFile(const juce::File& mappingFile,
+                                                          juce::String& errorMessage);
+
+    /** Mapping.json next to the scene library */
+    static juce::File getDefaultMappingFile();
+
+    //==============================================================================
+    /** Returns the entry for a parameter, or nullptr if it isn't mapped */
+    const Entry* getEntry(int paramIndex) const noexcept
+    {
+        if (paramIndex < 0 || paramIndex >= Layout::totalParameters || !entries[(size_t) paramIndex].isMapped)
+            return nullptr;
+
+        return &entries[(size_t) paramIndex];
+    }
+
+    /** Looks up an incoming CC */
+    Input findInput(int portIndex, int midiChannel, int ccNumber) const noexcept
+    {
+        if (portIndex < 1 || portIndex > 2 || midiChannel < 1 || midiChannel > 16 || ccNumber < 0 || ccNumber > 127)
+            return {};
+
+        return inputs[(size_t) Layout::reverseIndex(portIndex, midiChannel, ccNumber)];
+    }
+
+    /** Per-parameter encoding constants, laid out for batch encoding */
+    const Encoding& getEncoding() const noexcept    { return encoding; }
+
+    /** Encodes one value as sent on the wire: 14-bit for faders, the CC value otherwise */
+    int encode(int paramIndex, float value) const noexcept
+    {
+        auto i = (size_t) paramIndex;
+        return encoding.offsets[i] + (int) (juce::jlimit(0.0f, 1.0f, value) * encoding.scales[i]);
+    }
+
+    /** The parameter an AUX value pair currently belongs to, or -1 */
+    int getAuxMuteParameter(int auxSlot) const noexcept
+    {
+        return (auxSlot >= 0 && auxSlot < Layout::numAuxMutes) ? auxSlotParameters[(size_t) auxSlot] : -1;
+    }
+
+private:
+    //==============================================================================
+    MidiMappingTable() = default;
+
+    struct BuiltInLayout {};
+    constexpr explicit MidiMappingTable(BuiltInLayout);
+
+    static const MidiMappingTable defaultTable;
+
+    alignas(64) std::array<Entry, Layout::totalParameters> entries {};
+    alignas(64) std::array<Input, 2 * 16 * 128> inputs {};
+    std::array<juce::int16, Layout::numAuxMutes> auxSlotParameters {};
+    Encoding encoding {};
+
+    /** Fills in encoding from entries */
+    constexpr void updateEncoding() noexcept;
+
+    struct ExtraInput
+    {
+        int paramIndex, portIndex, midiChannel, ccNumber;
+    };
+
+    bool compile(const juce::Array<ExtraInput>& extraInputs, juce::String& errorMessage);
+
+    //==============================================================================
+    // No leak detector: it would stop the shared table being a constant
+    JUCE_DECLARE_NON_COPYABLE (MidiMappingTable)
+};
@@ -0,0 +1,276 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiMonitorComponent.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "MidiMonitorComponent.h"
+
+//==============================================================================
+MidiMonitorComponent::MidiMonitorComponent(MidiTrafficCapture& trafficCapture)
+    : capture(trafficCapture),
+      history((size_t) historySize)
+{
+    parameterMatches.fill(true);
+
+    channelFilterBox.addItem("All channels", 1);
+    for (int channel = 1; channel <= 16; ++channel)
+        channelFilterBox.addItem("Channel " + juce::String(channel), channel + 1);
+
+    channelFilterBox.setSelectedId(1, juce::dontSendNotification);
+    channelFilterBox.onChange = [this]
+    {
+        channelFilter = channelFilterBox.getSelectedId() - 1;
+        rebuildVisibleEvents();
+    };
+    addAndMakeVisible(channelFilterBox);
+
+    parameterFilterEditor.setTextToShowWhenEmpty("Parameter filter", juce::Colours::grey);
+    parameterFilterEditor.onTextChange = [this] { parameterFilterChanged(); };
+    addAndMakeVisible(parameterFilterEditor);
+
+    freezeButton.onClick = [this]
+    {
+        frozen = freezeButton.getToggleState();
+
+        if (frozen)
+            capture.stop();
+        else
+            capture.start();
+
+        updateStatus();
+    };
+    addAndMakeVisible(freezeButton);
+
+    clearButton.onClick = [this] { clearHistory(); };
+    addAndMakeVisible(clearButton);
+
+    statusLabel.setJustificationType(juce::Justification::centredRight);
+    addAndMakeVisible(statusLabel);
+
+    list.setRowHeight(16);
+    list.setColour(juce::ListBox::backgroundColourId, juce::Colour(0xff1a1a1a));
+    addAndMakeVisible(list);
+
+    // Anything left over from an earlier monitor is stale
+    MidiTrafficCapture::Event stale;
+    while (capture.read(stale)) {}
+    capture.takeNumDropped();
+
+    capture.start();
+    startTimerHz(refreshRateHz);
+    updateStatus();
+}
+
+MidiMonitorComponent::~MidiMonitorComponent()
+{
+    stopTimer();
+    capture.stop();
+}
+
+//==============================================================================
+void MidiMonitorComponent::paint(juce::Graphics& g)
+{
+    g.fillAll(juce::Colour(0xff2a2a2a));
+
+    g.setColour(juce::Colours::darkgrey);
+    g.drawRect(getLocalBounds(), 1);
+}
+
+void MidiMonitorComponent::resized()
+{
+    auto bounds = getLocalBounds().reduced(4);
+    auto toolbar = bounds.removeFromTop(24);
+
+    channelFilterBox.setBounds(toolbar.removeFromLeft(120));
+    toolbar.removeFromLeft(6);
+    parameterFilterEditor.setBounds(toolbar.removeFromLeft(180));
+    toolbar.removeFromLeft(6);
+    freezeButton.setBounds(toolbar.removeFromLeft(80));
+    clearButton.setBounds(toolbar.removeFromLeft(60));
+    toolbar.removeFromLeft(6);
+    statusLabel.setBounds(toolbar);
+
+    bounds.removeFromTop(4);
+    list.setBounds(bounds);
+}
+
+//==============================================================================
+// Capture
+
+void MidiMonitorComponent::timerCallback()
+{
+    if (frozen)
+        return;
+
+    // At most one ring's worth per frame, so a flood can't stall the UI
+    Event event;
+    bool changed = false;
+
+    for (int i = 0; i < MidiTrafficCapture::ringSize && capture.read(event); ++i)
+    {
+        if (firstEventTimeMs < 0.0)
+            firstEventTimeMs = event.timeMs;
+
+        history[(size_t) (numReceived % historySize)] = event;
+
+        if (passesFilters(event))
+            visibleEvents.push_back(numReceived);
+
+        ++numReceived;
+        changed = true;
+    }
+
+    numDropped += capture.takeNumDropped();
+
+    if (!changed)
+        return;
+
+    // Forget rows whose events have been overwritten
+    while (!visibleEvents.empty() && visibleEvents.front() < numReceived - historySize)
+        visibleEvents.pop_front();
+
+    list.updateContent();
+
+    if (!visibleEvents.empty())
+        list.scrollToEnsureRowIsOnscreen(getNumRows() - 1);
+
+    updateStatus();
+}
+
+const MidiMonitorComponent::Event& MidiMonitorComponent::getEvent(juce::int64 eventNumber) const noexcept
+{
+    return history[(size_t) (eventNumber % historySize)];
+}
+
+bool MidiMonitorComponent::passesFilters(const Event& event) const noexcept
+{
+    if (channelFilter > 0)
+        if (event.status >= 0xF0 || (event.status & 0x0F) + 1 != channelFilter)
+            return false;
+
+    if (parameterFilterActive)
+        return event.paramIndex >= 0 && event.paramIndex < CinemixConsole::totalParameters
+                   && parameterMatches[(size_t) event.paramIndex];
+
+    return true;
+}
+
+//==============================================================================
+// Filters
+
+void MidiMonitorComponent::parameterFilterChanged()
+{
+    auto text = parameterFilterEditor.getText().trim();
+    parameterFilterActive = text.isNotEmpty();
+
+    // Matched once per parameter here, not once per event
+    for (int i = 0; i < CinemixConsole::totalParameters; ++i)
+        parameterMatches[(size_t) i] = !parameterFilterActive
+                                           || CinemixConsole::getParameterName(i).containsIgnoreCase(text)
+                                           || CinemixConsole::getParameterID(i).containsIgnoreCase(text);
+
+    rebuildVisibleEvents();
+}
+
+void MidiMonitorComponent::rebuildVisibleEvents()
+{
+    visibleEvents.clear();
+
+    for (auto n = juce::jmax((juce::int64) 0, numReceived - historySize); n < numReceived; ++n)
+        if (passesFilters(getEvent(n)))
+            visibleEvents.push_back(n);
+
+    list.updateContent();
+    list.repaint();
+
+    if (!visibleEvents.empty())
+        list.scrollToEnsureRowIsOnscreen(getNumRows() - 1);
+
+    updateStatus();
+}
+
+void MidiMonitorComponent::clearHistory()
+{
+    numReceived = 0;
+    numDropped = 0;
+    firstEventTimeMs = -1.0;
+    visibleEvents.clear();
+
+    list.updateContent();
+    list.repaint();
+    updateStatus();
+}
+
+void MidiMonitorComponent::updateStatus()
+{
+    juce::String status;
+    status << (juce::int64) visibleEvents.size() << " shown, " << numReceived << " captured";
+
+    if (numDropped > 0)
+        status << ", " << numDropped << " dropped";
+
+    if (frozen)
+        status << " (frozen)";
+
+    statusLabel.setText(status, juce::dontSendNotification);
+}
+
+//==============================================================================
+// List
+
+int MidiMonitorComponent::getNumRows()
+{
+    return (int) visibleEvents.size();
+}
+
+void MidiMonitorComponent::paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected)
+{
+    if (rowNumber < 0 || rowNumber >= getNumRows())
+        return;
+
+    const auto& event = getEvent(visibleEvents[(size_t) rowNumber]);
+    bool outgoing = (event.flags & MidiTrafficCapture::outgoingFlag) != 0;
+
+    if (rowIsSelected)
+        g.fillAll(juce::Colours::darkblue);
+
+    g.setColour(outgoing ? juce::Colours::lightgreen : juce::Colours::orange);
+    g.setFont(juce::FontOptions(juce::Font::getDefaultMonospacedFontName(), 12.0f, juce::Font::plain));
+
+    juce::String message;
+
+    if ((event.status & 0xF0) == 0xB0)
+    {
+        message << "Ch " << ((event.status & 0x0F) + 1) << "  CC " << (int) event.data1;
+
+        if ((event.flags & MidiTrafficCapture::faderPairFlag) != 0)
+            message << "/" << ((int) event.data1 + 1);
+    }
+    else
+    {
+        message = juce::String::toHexString(event.status).toUpperCase();
+    }
+
+    auto time = juce::String((event.timeMs - firstEventTimeMs) / 1000.0, 3);
+    auto name = event.paramIndex >= 0 ? CinemixConsole::getParameterName(event.paramIndex) : juce::String();
+
+    juce::Rectangle<int> row(4, 0, width - 8, height);
+
+    g.drawText(time, row.removeFromLeft(80), juce::Justification::centredRight);
+    row.removeFromLeft(12);
+    g.drawText(outgoing ? "OUT" : "IN", row.removeFromLeft(36), juce::Justification::centredLeft);
+    g.drawText("P" + juce::String((int) event.portIndex), row.removeFromLeft(28), juce::Justification::centredLeft);
+    g.drawText(message, row.removeFromLeft(130), juce::Justification::centredLeft);
+    g.drawText(juce::String((int) event.value), row.removeFromLeft(50), juce::Justification::centredRight);
+    row.removeFromLeft(12);
+    g.drawText(name, row, juce::Justification::centredLeft);
+}
@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiMonitorComponent.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <deque>
+#include <vector>
+#include "ConsoleLayout.h"
+#include "MidiTrafficCapture.h"
+
+//==============================================================================
+/**
+ * MidiMonitorComponent
+ *
+ * Shows what a router sends to and receives from the console: time, port,
+ * direction, MIDI channel and controller, value and the parameter it
+ * decodes to.
+ *
+ * The capture runs only while this component exists (and isn't frozen).
+ * A timer drains the capture ring at the display rate into a fixed-size
+ * history, so the cost per frame depends on the traffic, not on how often
+ * the list is drawn. The list is a ListBox and only formats the rows on
+ * screen, however long the history.
+ *
+ * Filters (MIDI channel, text in the parameter name or ID) apply to the
+ * history as it stands and to everything that arrives afterwards. Freeze
+ * stops the capture so the list can be scrolled and read.
+ */
+class MidiMonitorComponent : public juce::Component,
+                             private juce::ListBoxModel,
+                             private juce::Timer
+{
+public:
+    //==============================================================================
+    explicit MidiMonitorComponent(MidiTrafficCapture& trafficCapture);
+    ~MidiMonitorComponent() override;
+
+    static constexpr int historySize = 16384;
+    static constexpr int refreshRateHz = 30;
+
+    //==============================================================================
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+
+private:
+    //==============================================================================
+    using Event = MidiTrafficCapture::Event;
+
+    MidiTrafficCapture& capture;
+
+    // Ring of the last historySize events; event n is at n % historySize
+    std::vector<Event> history;
+    juce::int64 numReceived = 0;
+    juce::int64 numDropped = 0;
+    double firstEventTimeMs = -1.0;
+
+    // Numbers of the events that pass the filters, oldest first
+    std::deque<juce::int64> visibleEvents;
+
+    int channelFilter = 0;  // 0 = all, otherwise 1-16
+    std::array<bool, CinemixConsole::totalParameters> parameterMatches;
+    bool parameterFilterActive = false;
+    bool frozen = false;
+
+    juce::ComboBox channelFilterBox;
+    juce::TextEditor parameterFilterEditor;
+    juce::ToggleButton freezeButton { "Freeze" };
+    juce::TextButton clearButton { "Clear" };
+    juce::Label statusLabel;
+    juce::ListBox list { "MIDI Traffic", this };
+
+    //==============================================================================
+    void timerCallback() override;
+
+    int getNumRows() override;
+    void paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
+
+    const Event& getEvent(juce::int64 eventNumber) const noexcept;
+    bool passesFilters(const Event& event) const noexcept;
+
+    void parameterFilterChanged();
+    void rebuildVisibleEvents();
+    void clearHistory();
+    void updateStatus();
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiMonitorComponent)
+};
@@ -0,0 +1,548 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiPortHub.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "MidiPortHub.h"
+#include "ConsoleCodec.h"
+#include "PipelineTrace.h"
+
+namespace
+{
+    constexpr juce::uint32 hasValueBit = 1u << 31;
+    constexpr juce::uint32 faderPairBit = 1u << 21;
+}
+
+//==============================================================================
+MidiPortHub::MidiPortHub()
+    : juce::Thread("Cinemix MIDI Out")
+{
+    startThread(juce::Thread::Priority::high);
+
+    // The notification arrives on the message thread; the watcher does the work
+    deviceListConnection = juce::MidiDeviceListConnection::make([this] { watcher.notify(); });
+    watcher.startThread(juce::Thread::Priority::low);
+}
+
+MidiPortHub::~MidiPortHub()
+{
+    deviceListConnection.reset();
+    watcher.stopThread(2000);
+
+    signalThreadShouldExit();
+    stopThread(2000);
+
+    const juce::ScopedLock sl(deviceLock);
+
+    for (int port = 0; port < numPorts; ++port)
+    {
+        ports[(size_t) port].inputUsers.clear();
+        ports[(size_t) port].outputUsers.clear();
+        closeUnusedDevices(port);
+    }
+}
+
+//==============================================================================
+// Clients
+
+void MidiPortHub::addClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->addIfNotAlreadyThere(client);
+    clients.update(std::move(updated));
+}
+
+void MidiPortHub::removeClient(Client* client)
+{
+    const juce::ScopedLock sl(clientLock);
+
+    auto updated = std::make_unique<juce::Array<Client*>>(*clients.read());
+    updated->removeFirstMatchingValue(client);
+
+    // Returns once no MIDI callback can still be inside the client
+    clients.update(std::move(updated));
+}
+
+void MidiPortHub::dispatchInput(int portIndex, const juce::MidiMessage& message)
+{
+    PipelineTrace::midi(PipelineTrace::Stage::consoleReceive, message.getRawData(), message.getRawDataSize());
+
+    auto list = clients.read();
+
+    for (auto* client : *list)
+        client->handleConsoleMessage(portIndex, message);
+}
+
+//==============================================================================
+// Devices
+
+void MidiPortHub::refreshDevices()
+{
+    auto lists = std::make_unique<DeviceLists>();
+    lists->inputs = juce::MidiInput::getAvailableDevices();
+    lists->outputs = juce::MidiOutput::getAvailableDevices();
+    lists->scanned = true;
+
+    const juce::ScopedLock sl(deviceListLock);
+    deviceLists.update(std::move(lists));
+}
+
+juce::Array<juce::MidiDeviceInfo> MidiPortHub::getAvailableInputs() const
+{
+    return deviceLists.read()->inputs;
+}
+
+juce::Array<juce::MidiDeviceInfo> MidiPortHub::getAvailableOutputs() const
+{
+    return deviceLists.read()->outputs;
+}
+
+bool MidiPortHub::resolvePorts(int inPort1Index, int inPort2Index, int outPort1Index, int outPort2Index,
+                               PortSelection& selection)
+{
+    // Called before the watcher's first scan, the lists would still be empty
+    if (!deviceLists.read()->scanned)
+        refreshDevices();
+
+    auto lists = deviceLists.read();
+    bool resolved = true;
+
+    auto pick = [&resolved](const juce::Array<juce::MidiDeviceInfo>& devices, int deviceIndex)
+    {
+        if (juce::isPositiveAndBelow(deviceIndex, devices.size()))
+            return devices[deviceIndex];
+
+        resolved = resolved && deviceIndex == -1;
+        return juce::MidiDeviceInfo();
+    };
+
+    selection.inputs[0] = pick(lists->inputs, inPort1Index);
+    selection.inputs[1] = pick(lists->inputs, inPort2Index);
+    selection.outputs[0] = pick(lists->outputs, outPort1Index);
+    selection.outputs[1] = pick(lists->outputs, outPort2Index);
+    return resolved;
+}
+
+bool MidiPortHub::openPorts(Client* client, int inPort1Index, int inPort2Index,
+                            int outPort1Index, int outPort2Index)
+{
+    PortSelection selection;
+
+    if (!resolvePorts(inPort1Index, inPort2Index, outPort1Index, outPort2Index, selection))
+        return false;
+
+    const juce::ScopedLock sl(deviceLock);
+    return joinPorts(client, selection);
+}
+
+bool MidiPortHub::joinPorts(Client* client, const PortSelection& selection)
+{
+    // deviceLock is held by the caller
+    auto joinInput = [&](int port, const juce::MidiDeviceInfo& info) -> bool
+    {
+        if (info.identifier.isEmpty())
+            return true;
+
+        auto& devices = ports[(size_t) port];
+
+        if (devices.inputIdentifier.isEmpty())
+        {
+            devices.input = juce::MidiInput::openDevice(info.identifier, &inputCallbacks[(size_t) port]);
+            if (devices.input == nullptr)
+                return false;
+
+            devices.input->start();
+            devices.inputIdentifier = info.identifier;
+            devices.inputName = info.name;
+        }
+        else if (devices.inputIdentifier != info.identifier)
+        {
+            return false;  // Another instance has this port on a different device
+        }
+
+        devices.inputUsers.addIfNotAlreadyThere(client);
+        return true;
+    };
+
+    auto joinOutput = [&](int port, const juce::MidiDeviceInfo& info) -> bool
+    {
+        if (info.identifier.isEmpty())
+            return true;
+
+        auto& devices = ports[(size_t) port];
+
+        if (devices.outputIdentifier.isEmpty())
+        {
+            auto output = juce::MidiOutput::openDevice(info.identifier);
+            if (output == nullptr)
+                return false;
+
+            outputs[(size_t) port].update(std::move(output));
+            streams[(size_t) port].faderValuesUnknown = true;
+            devices.outputIdentifier = info.identifier;
+            devices.outputName = info.name;
+        }
+        else if (devices.outputIdentifier != info.identifier)
+        {
+            return false;
+        }
+
+        devices.outputUsers.addIfNotAlreadyThere(client);
+        return true;
+    };
+
+    bool success = joinInput(0, selection.inputs[0]);
+    success = joinInput(1, selection.inputs[1]) && success;
+    success = joinOutput(0, selection.outputs[0]) && success;
+    success = joinOutput(1, selection.outputs[1]) && success;
+    return success;
+}
+
+void MidiPortHub::releasePorts(Client* client)
+{
+    const juce::ScopedLock sl(deviceLock);
+
+    for (int port = 0; port < numPorts; ++port)
+    {
+        ports[(size_t) port].inputUsers.removeFirstMatchingValue(client);
+        ports[(size_t) port].outputUsers.removeFirstMatchingValue(client);
+        closeUnusedDevices(port);
+    }
+}
+
+void MidiPortHub::closeUnusedDevices(int port)
+{
+    auto& devices = ports[(size_t) port];
+
+    // Unplugged devices count too: they have no handle but still an identifier
+    if (devices.inputUsers.isEmpty() && devices.inputIdentifier.isNotEmpty())
+    {
+        if (devices.input != nullptr)
+            devices.input->stop();
+
+        devices.input.reset();
+        devices.inputIdentifier.clear();
+        devices.inputName.clear();
+    }
+
+    if (devices.outputUsers.isEmpty() && devices.outputIdentifier.isNotEmpty())
+    {
+        // Whatever comes up on this port next needs initialising again
+        consoleLive = false;
+
+        // Waits for the pacing thread to finish with the handle
+        outputs[(size_t) port].update(nullptr);
+        devices.outputIdentifier.clear();
+        devices.outputName.clear();
+        devices.outputLostAtMs = 0.0;
+    }
+}
+
+void MidiPortHub::checkDevices()
+{
+    refreshDevices();
+
+    auto inputDevices = getAvailableInputs();
+    auto outputDevices = getAvailableOutputs();
+
+    auto isAvailable = [](const juce::Array<juce::MidiDeviceInfo>& devices, const juce::String& identifier)
+    {
+        for (const auto& info : devices)
+            if (info.identifier == identifier)
+                return true;
+
+        return false;
+    };
+
+    bool outputReconnected = false;
+    bool needsFullResync = false;
+
+    {
+        const juce::ScopedLock sl(deviceLock);
+        auto nowMs = juce::Time::getMillisecondCounterHiRes();
+
+        for (int port = 0; port < numPorts; ++port)
+        {
+            auto& devices = ports[(size_t) port];
+
+            if (devices.inputIdentifier.isNotEmpty())
+            {
+                bool available = isAvailable(inputDevices, devices.inputIdentifier);
+
+                if (devices.input != nullptr && !available)
+                {
+                    devices.input->stop();
+                    devices.input.reset();
+                }
+                else if (devices.input == nullptr && available)
+                {
+                    devices.input = juce::MidiInput::openDevice(devices.inputIdentifier, &inputCallbacks[(size_t) port]);
+
+                    if (devices.input != nullptr)
+                        devices.input->start();
+                }
+            }
+
+            if (devices.outputIdentifier.isNotEmpty())
+            {
+                bool available = isAvailable(outputDevices, devices.outputIdentifier);
+
+                bool isOpen = isOutputOpen(port);
+
+                if (isOpen && !available)
+                {
+                    // The pacing thread now keeps this port's values pending
+                    outputs[(size_t) port].update(nullptr);
+                    devices.outputLostAtMs = nowMs;
+                }
+                else if (!isOpen && available)
+                {
+                    // Retried on the next check if the device isn't ready yet
+                    auto output = juce::MidiOutput::openDevice(devices.outputIdentifier);
+
+                    if (output != nullptr)
+                    {
+                        outputs[(size_t) port].update(std::move(output));
+                        streams[(size_t) port].faderValuesUnknown = true;
+                        outputReconnected = true;
+                        needsFullResync = needsFullResync || nowMs - devices.outputLostAtMs > powerCycleOutageMs;
+                        devices.outputLostAtMs = 0.0;
+                    }
+                }
+            }
+        }
+    }
+
+    if (!outputReconnected)
+        return;
+
+    // No reply to the activation command exists, so the outage length is
+    // the evidence: long enough to have rebooted and the handshake runs again
+    if (needsFullResync)
+        consoleLive = false;
+
+    auto list = clients.read();
+
+    for (auto* client : *list)
+        client->consoleReconnected(needsFullResync);
+}
+
+bool MidiPortHub::areOutputsOpen() const
+{
+    return isOutputOpen(0) && isOutputOpen(1);
+}
+
+juce::String MidiPortHub::getPortStatusString() const
+{
+    const juce::ScopedLock sl(deviceLock);
+
+    auto describe = [](bool isOpen, const juce::String& identifier, const juce::String& name) -> juce::String
+    {
+        if (isOpen)
+            return name;
+
+        return identifier.isNotEmpty() ? name + " (disconnected)" : "None";
+    };
+
+    juce::String status;
+    status << "IN1: " << describe(ports[0].input != nullptr, ports[0].inputIdentifier, ports[0].inputName) << "\n";
+    status << "IN2: " << describe(ports[1].input != nullptr, ports[1].inputIdentifier, ports[1].inputName) << "\n";
+    status << "OUT1: " << describe(isOutputOpen(0), ports[0].outputIdentifier, ports[0].outputName) << "\n";
+    status << "OUT2: " << describe(isOutputOpen(1), ports[1].outputIdentifier, ports[1].outputName);
+    return status;
+}
+
+//==============================================================================
+// Output (any thread)
+
+void MidiPortHub::sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs)
+{
+    if (portIndex < 1 || portIndex > numPorts)
+        return;
+
+    // The console only takes short messages
+    auto size = message.getRawDataSize();
+    if (size < 1 || size > 3)
+        return;
+
+    OrderedMessage ordered;
+    ordered.dueTimeMs = dueTimeMs;
+    ordered.size = (juce::uint8) size;
+    std::memcpy(ordered.data, message.getRawData(), (size_t) size);
+
+    // Dropped if the port is hopelessly behind
+    auto& stream = streams[(size_t) (portIndex - 1)];
+
+    if (stream.ordered.push(ordered))
+        stream.updateHighWater();
+}
+
+void MidiPortHub::sendBlock(int portIndex, const juce::MidiBuffer& buffer,
+                            double startTimeMs, double sampleRate)
+{
+    if (sampleRate <= 0.0)
+        return;
+
+    for (const auto metadata : buffer)
+        sendOrdered(portIndex, metadata.getMessage(),
+                    startTimeMs + metadata.samplePosition * 1000.0 / sampleRate);
+}
+
+void MidiPortHub::sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value)
+{
+    if (portIndex < 1 || portIndex > numPorts || midiChannel < 1 || midiChannel > 16 || ccNumber < 0 || ccNumber > 127)
+        return;
+
+    auto& stream = streams[(size_t) (portIndex - 1)];
+    auto key = (juce::uint16) ((midiChannel - 1) * 128 + ccNumber);
+
+    // Only the first value since the last send queues the CC; later ones just replace it
+    if (stream.pendingValues[key].exchange(hasValueBit | (juce::uint32) (value & 0x7F)) == 0 && stream.pendingKeys.push(key))
+        stream.updateHighWater();
+}
+
+void MidiPortHub::sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit)
+{
+    if (portIndex < 1 || portIndex > numPorts || midiChannel < 1 || midiChannel > 16
+        || msbCcNumber < 0 || msbCcNumber > 127 || lsbCcNumber < 0 || lsbCcNumber > 127)
+        return;
+
+    auto& stream = streams[(size_t) (portIndex - 1)];
+    auto key = (juce::uint16) ((midiChannel - 1) * 128 + msbCcNumber);
+    auto encoded = hasValueBit | faderPairBit | ((juce::uint32) lsbCcNumber << 14) | (juce::uint32) (value14Bit & 0x3FFF);
+
+    if (stream.pendingValues[key].exchange(encoded) == 0 && stream.pendingKeys.push(key))
+        stream.updateHighWater();
+}
+
+void MidiPortHub::forgetSentFaderValues()
+{
+    for (auto& stream : streams)
+        stream.faderValuesUnknown = true;
+}
+
+ConsoleTransport::QueueStats MidiPortHub::getQueueStats(int portIndex) const
+{
+    if (portIndex < 1 || portIndex > numPorts)
+        return {};
+
+    const auto& stream = streams[(size_t) (portIndex - 1)];
+    return { stream.getDepth(), stream.highWater.load(std::memory_order_relaxed) };
+}
+
+//==============================================================================
+// Pacing Thread
+
+void MidiPortHub::run()
+{
+    auto lastTimeMs = juce::Time::getMillisecondCounterHiRes();
+
+    while (!threadShouldExit())
+    {
+        auto nowMs = juce::Time::getMillisecondCounterHiRes();
+        auto elapsedMs = nowMs - lastTimeMs;
+        lastTimeMs = nowMs;
+
+        // No deviceLock: opening or closing a device never stalls the output
+        for (int port = 1; port <= numPorts; ++port)
+        {
+            auto& stream = streams[(size_t) (port - 1)];
+            stream.budgetBytes = juce::jmin(maxBurstBytes, stream.budgetBytes + elapsedMs * bytesPerMs);
+            pumpPort(port, nowMs);
+        }
+
+        wait(1);
+    }
+}
+
+void MidiPortHub::pumpPort(int portIndex, double nowMs)
+{
+    auto& stream = streams[(size_t) (portIndex - 1)];
+
+    // Kept alive until this pump is done, even if the port is closed meanwhile
+    auto output = outputs[(size_t) (portIndex - 1)].read();
+
+    auto sendNow = [&output](const juce::MidiMessage& message)
+    {
+        // With no device the message is dropped
+        if (output)
+        {
+            PipelineTrace::midi(PipelineTrace::Stage::wireWrite, message.getRawData(), message.getRawDataSize());
+            output->sendMessageNow(message);
+        }
+    };
+
+    // Ordered traffic first, up to the first message that isn't due yet
+    for (;;)
+    {
+        if (!stream.hasHeldMessage)
+            stream.hasHeldMessage = stream.ordered.pop(stream.heldMessage);
+
+        if (!stream.hasHeldMessage || stream.heldMessage.dueTimeMs > nowMs)
+            break;
+
+        if (stream.budgetBytes < stream.heldMessage.size)
+            return;
+
+        sendNow(juce::MidiMessage(stream.heldMessage.data, stream.heldMessage.size));
+        stream.budgetBytes -= stream.heldMessage.size;
+        stream.hasHeldMessage = false;
+    }
+
+    // Then the latest value of every control that changed. While the device
+    // is unplugged they wait here, so reconnecting sends just the changes
+    if (!output)
+        return;
+
+    if (stream.faderValuesUnknown.exchange(false))
+        stream.sentFaderValues.fill(-1);
+
+    juce::uint16 key = 0;
+
+    while (stream.budgetBytes >= 6.0 && stream.pendingKeys.pop(key))
+    {
+        auto encoded = stream.pendingValues[key].exchange(0);
+        if (encoded == 0)
+            continue;
+
+        int midiChannel = key / 128 + 1;
+        int ccNumber = key % 128;
+
+        if ((encoded & faderPairBit) != 0)
+        {
+            int value14Bit = (int) (encoded & 0x3FFF);
+            int lsbCcNumber = (int) ((encoded >> 14) & 0x7F);
+            auto& sentValue = stream.sentFaderValues[key];
+            auto halves = CinemixCodec::getFaderHalves(sentValue, value14Bit);
+            sentValue = (juce::int16) value14Bit;
+
+            if ((halves & CinemixCodec::sendMsb) != 0)
+            {
+                sendNow(juce::MidiMessage::controllerEvent(midiChannel, ccNumber, (value14Bit >> 7) & 0x7F));
+                stream.budgetBytes -= 3.0;
+            }
+
+            if ((halves & CinemixCodec::sendLsb) != 0)
+            {
+                sendNow(juce::MidiMessage::controllerEvent(midiChannel, lsbCcNumber, value14Bit & 0x7F));
+                stream.budgetBytes -= 3.0;
+            }
+        }
+        else
+        {
+            sendNow(juce::MidiMessage::controllerEvent(midiChannel, ccNumber, (int) (encoded & 0x7F)));
+            stream.budgetBytes -= 3.0;
+        }
+    }
+}
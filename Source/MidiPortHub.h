@@ -0,0 +1,252 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiPortHub.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "ConsoleTransport.h"
+#include "MpscQueue.h"
+#include "RcuPointer.h"
+#include "RealtimeAudit.h"
+
+//==============================================================================
+/**
+ * MidiPortHub
+ *
+ * The console's MIDI devices, shared by every plugin instance in the process.
+ * MidiRouter holds it through juce::SharedResourcePointer, so the hub exists
+ * while at least one router does, and each device is opened at most once.
+ *
+ * Input: every message from the console is handed to all clients; each
+ * MidiRouter decodes it and keeps only the parameters in its channel range.
+ * The client list is read wait-free on the MIDI thread (see RcuPointer).
+ *
+ * Output: one paced stream per port, sent by the hub's own thread at the
+ * 31.25 kbaud wire rate the console can take. Two kinds of traffic feed it:
+ * - Ordered messages (system commands, AUX mutes, timed automation blocks)
+ *   are sent in order, each at or after its due time.
+ * - Parameter values are coalesced per CC: if a control changes again
+ *   before its previous value went out, only the latest value is sent.
+ *   Of a fader's MSB/LSB pair only the half that changed since the last
+ *   send goes out; both go out together after the device is (re)opened.
+ * Both are lock-free to enqueue, so any thread (including audio) can send.
+ * The pacing thread takes no lock either: output handles are published
+ * through RcuPointer, so a port can be opened, swapped or closed at any time
+ * while a send is in progress - the old handle is only deleted once the
+ * pacing thread has let go of it, and only the thread closing it waits.
+ *
+ * Devices are enumerated on a background watcher thread, so neither the
+ * editor nor plugin loading waits for the MIDI system; clients read the
+ * cached device lists. Only openPorts() scans in place, if it comes before
+ * the watcher's first scan.
+ *
+ * Hot-plug: devices are tracked by identifier. When one disappears (cable
+ * bump, interface reset) its handle is closed but its users are kept, and a
+ * watcher thread reopens it as soon as the device list shows it again -
+ * woken by the OS device-change notification, with a slow poll as backup.
+ * While an output is missing its coalesced values stay pending, so on
+ * reconnect only the controls that changed meanwhile are sent. An outage
+ * long enough for the console to have been power-cycled clears
+ * isConsoleLive(), and clients re-run the initialisation handshake.
+ */
+class MidiPortHub : public ConsoleTransport,
+                    private juce::Thread
+{
+public:
+    //==============================================================================
+    MidiPortHub();
+    ~MidiPortHub() override;
+
+    //==============================================================================
+    void addClient(Client* client) override;
+
+    /** Doesn't return while the client is being called */
+    void removeClient(Client* client) override;
+
+    //==============================================================================
+    // Devices
+
+    /** Enumerates the devices now (blocking) and updates the lists below */
+    void refreshDevices();
+
+    juce::Array<juce::MidiDeviceInfo> getAvailableInputs() const override;
+    juce::Array<juce::MidiDeviceInfo> getAvailableOutputs() const override;
+
+    /**
+     * Opens (or joins) the console ports by index into the available device
+     * lists (-1 = don't use). Any other index that isn't in the lists opens
+     * nothing and returns false. A port another client already opened on a
+     * different device is left alone and the call returns false.
+     */
+    bool openPorts(Client* client, int inPort1Index, int inPort2Index,
+                   int outPort1Index, int outPort2Index) override;
+
+    /** A device closes when its last user leaves */
+    void releasePorts(Client* client) override;
+
+    bool areOutputsOpen() const override;
+    juce::String getPortStatusString() const override;
+
+    /** Cleared whenever an output device closes, or comes back after a long outage */
+    bool isConsoleLive() const override         { return consoleLive.load(); }
+    void setConsoleLive(bool isLive) override   { consoleLive = isLive; }
+
+    //==============================================================================
+    // Output
+
+    void sendOrdered(int portIndex, const juce::MidiMessage& message, double dueTimeMs = 0.0) override;
+    void sendBlock(int portIndex, const juce::MidiBuffer& buffer, double startTimeMs, double sampleRate) override;
+    void sendControllerValue(int portIndex, int midiChannel, int ccNumber, int value) override;
+    void sendFaderValue(int portIndex, int midiChannel, int msbCcNumber, int lsbCcNumber, int value14Bit) override;
+    void forgetSentFaderValues() override;
+
+    QueueStats getQueueStats(int portIndex) const override;
+
+private:
+    //==============================================================================
+    static constexpr int numPorts = 2;
+
+    // MIDI 1.0 wire rate: 31250 baud, 10 bits per byte
+    static constexpr double bytesPerMs = 3.125;
+    static constexpr double maxBurstBytes = 48.0;
+
+    // The console takes several seconds to boot, a cable bump far less
+    static constexpr double powerCycleOutageMs = 1500.0;
+    static constexpr int devicePollIntervalMs = 500;
+
+    struct InputCallback : public juce::MidiInputCallback
+    {
+        InputCallback(MidiPortHub& h, int port) : hub(h), portIndex(port) {}
+
+        void handleIncomingMidiMessage(juce::MidiInput*, const juce::MidiMessage& message) override
+        {
+            CINEMIX_RT_AUDIT_SCOPE("MidiPortHub::handleIncomingMidiMessage");
+            hub.dispatchInput(portIndex, message);
+        }
+
+        MidiPortHub& hub;
+        const int portIndex;
+    };
+
+    /** Rescans the devices and reopens lost ones */
+    struct DeviceWatcher : public juce::Thread
+    {
+        explicit DeviceWatcher(MidiPortHub& h) : juce::Thread("Cinemix MIDI Devices"), hub(h) {}
+
+        void run() override
+        {
+            while (!threadShouldExit())
+            {
+                hub.checkDevices();
+                wait(devicePollIntervalMs);
+            }
+        }
+
+        MidiPortHub& hub;
+    };
+
+    // A device with users but no handle has been unplugged and is waiting to come back.
+    // The output handle lives in outputs, so the pacing thread can read it without deviceLock
+    struct PortDevices
+    {
+        std::unique_ptr<juce::MidiInput> input;
+        juce::String inputIdentifier, outputIdentifier;
+        juce::String inputName, outputName;
+        juce::Array<Client*> inputUsers, outputUsers;
+        double outputLostAtMs = 0.0;
+    };
+
+    struct DeviceLists
+    {
+        juce::Array<juce::MidiDeviceInfo> inputs, outputs;
+        bool scanned = false;   // False until the first refreshDevices()
+    };
+
+    // Devices per port; an empty identifier means the port isn't used
+    struct PortSelection
+    {
+        std::array<juce::MidiDeviceInfo, numPorts> inputs, outputs;
+    };
+
+    struct OrderedMessage
+    {
+        double dueTimeMs = 0.0;
+        juce::uint8 data[3] {};
+        juce::uint8 size = 0;
+    };
+
+    struct OutputStream
+    {
+        // Pending coalesced value per (channel, CC); 0 = nothing waiting.
+        // Bit 31 marks a value, bit 21 a fader pair, bits 14-20 the LSB CC
+        std::array<std::atomic<juce::uint32>, 16 * 128> pendingValues {};
+        MpscQueue<juce::uint16, 16 * 128> pendingKeys;
+        MpscQueue<OrderedMessage, 1024> ordered;
+        std::atomic<int> highWater { 0 };
+
+        /** Depth of both queues together */
+        int getDepth() const noexcept { return ordered.getNumReady() + pendingKeys.getNumReady(); }
+
+        /** Called by producers after a push */
+        void updateHighWater() noexcept
+        {
+            auto depth = getDepth();
+            auto highest = highWater.load(std::memory_order_relaxed);
+
+            while (depth > highest && !highWater.compare_exchange_weak(highest, depth, std::memory_order_relaxed)) {}
+        }
+
+        // Set from any thread: sentFaderValues are out of date
+        std::atomic<bool> faderValuesUnknown { true };
+
+        // Pacing thread only
+        OrderedMessage heldMessage;
+        bool hasHeldMessage = false;
+        double budgetBytes = maxBurstBytes;
+        std::array<juce::int16, 16 * 128> sentFaderValues {};     // Per MSB (channel, CC); -1 = unknown
+    };
+
+    std::array<InputCallback, numPorts> inputCallbacks { { { *this, 1 }, { *this, 2 } } };
+    std::array<PortDevices, numPorts> ports;
+    std::array<RcuPointer<juce::MidiOutput>, numPorts> outputs;     // Replaced under deviceLock
+    std::array<OutputStream, numPorts> streams;
+    juce::CriticalSection deviceLock;
+    std::atomic<bool> consoleLive { false };
+
+    RcuPointer<juce::Array<Client*>> clients { std::make_unique<juce::Array<Client*>>() };
+    juce::CriticalSection clientLock;
+
+    RcuPointer<DeviceLists> deviceLists { std::make_unique<DeviceLists>() };
+    juce::CriticalSection deviceListLock;
+
+    DeviceWatcher watcher { *this };
+    juce::MidiDeviceListConnection deviceListConnection;
+
+    void dispatchInput(int portIndex, const juce::MidiMessage& message);
+
+    bool resolvePorts(int inPort1Index, int inPort2Index, int outPort1Index, int outPort2Index,
+                      PortSelection& selection);
+    bool joinPorts(Client* client, const PortSelection& selection);
+    void checkDevices();
+
+    void run() override;
+    void pumpPort(int portIndex, double nowMs);
+    bool isOutputOpen(int port) const noexcept { return outputs[(size_t) port].read().get() != nullptr; }
+    void closeUnusedDevices(int portIndex);
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiPortHub)
+};
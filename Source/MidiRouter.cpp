@@ -13,20 +13,48 @@
 */
 
 #include "MidiRouter.h"
+#include "PipelineTrace.h"
 
 //==============================================================================
 MidiRouter::MidiRouter()
 {
     // Initialize previous values to -1 (force send on first update)
-    previousMidiValues.fill(-1);
+    clearMidiCache();
+    
+    // A running bridge daemon owns the console; otherwise use the devices here
+    if (BridgeClient::isDaemonRunning())
+    {
+        bridgeClient = std::make_unique<juce::SharedResourcePointer<BridgeClient>>();
+        
+        if (bridgeClient->getObject().isConnected())
+            deviceTransport = &bridgeClient->getObject();
+        else
+            bridgeClient.reset();  // No free slot
+    }
+    
+    if (deviceTransport == nullptr)
+    {
+        portHub = std::make_unique<juce::SharedResourcePointer<MidiPortHub>>();
+        deviceTransport = &portHub->getObject();
+    }
+    
+    transport = deviceTransport;
+    deviceTransport->addClient(this);
+}
+
+MidiRouter::MidiRouter(ConsoleTransport& customTransport)
+{
+    clearMidiCache();
     
-    // Build the complete parameter-to-MIDI mapping table
-    initializeMappingTable();
+    deviceTransport = &customTransport;
+    transport = deviceTransport;
+    deviceTransport->addClient(this);
 }
 
 MidiRouter::~MidiRouter()
 {
     closeMidiPorts();
+    getTransport().removeClient(this);
 }
 
 //==============================================================================
@@ -35,7 +63,7 @@ MidiRouter::~MidiRouter()
 juce::StringArray MidiRouter::getAvailableMidiInputs() const
 {
     juce::StringArray names;
-    auto devices = juce::MidiInput::getAvailableDevices();
+    auto devices = getTransport().getAvailableInputs();
     for (const auto& device : devices)
         names.add(device.name);
     return names;
@@ -44,7 +72,7 @@ juce::StringArray MidiRouter::getAvailableMidiInputs() const
 juce::StringArray MidiRouter::getAvailableMidiOutputs() const
 {
     juce::StringArray names;
-    auto devices = juce::MidiOutput::getAvailableDevices();
+    auto devices = getTransport().getAvailableOutputs();
     for (const auto& device : devices)
         names.add(device.name);
     return names;
@@ -55,186 +83,274 @@ bool MidiRouter::openMidiPorts(int inPort1Index, int inPort2Index,
 {
     closeMidiPorts();  // Close any existing connections
     
-    auto inputDevices = juce::MidiInput::getAvailableDevices();
-    auto outputDevices = juce::MidiOutput::getAvailableDevices();
-    
-    bool success = true;
-    
-    // Open Input Port 1 (LOW section)
-    if (inPort1Index >= 0 && inPort1Index < inputDevices.size())
-    {
-        midiIn1 = juce::MidiInput::openDevice(inputDevices[inPort1Index].identifier, this);
-        if (midiIn1)
-        {
-            midiIn1->start();
-            midiIn1Name = inputDevices[inPort1Index].name;
-        }
-        else
-            success = false;
-    }
-    
-    // Open Input Port 2 (HIGH section)
-    if (inPort2Index >= 0 && inPort2Index < inputDevices.size())
-    {
-        midiIn2 = juce::MidiInput::openDevice(inputDevices[inPort2Index].identifier, this);
-        if (midiIn2)
-        {
-            midiIn2->start();
-            midiIn2Name = inputDevices[inPort2Index].name;
-        }
-        else
-            success = false;
-    }
-    
-    // Open Output Port 1 (LOW section)
-    if (outPort1Index >= 0 && outPort1Index < outputDevices.size())
-    {
-        midiOut1 = juce::MidiOutput::openDevice(outputDevices[outPort1Index].identifier);
-        if (midiOut1)
-            midiOut1Name = outputDevices[outPort1Index].name;
-        else
-            success = false;
-    }
-    
-    // Open Output Port 2 (HIGH section)
-    if (outPort2Index >= 0 && outPort2Index < outputDevices.size())
-    {
-        midiOut2 = juce::MidiOutput::openDevice(outputDevices[outPort2Index].identifier);
-        if (midiOut2)
-            midiOut2Name = outputDevices[outPort2Index].name;
-        else
-            success = false;
-    }
-    
-    return success;
+    // Devices another instance already opened are shared, not reopened
+    return getTransport().openPorts(this, inPort1Index, inPort2Index, outPort1Index, outPort2Index);
 }
 
 void MidiRouter::closeMidiPorts()
 {
-    if (midiIn1) midiIn1->stop();
-    if (midiIn2) midiIn2->stop();
-    
-    midiIn1.reset();
-    midiIn2.reset();
-    midiOut1.reset();
-    midiOut2.reset();
-    
-    midiIn1Name.clear();
-    midiIn2Name.clear();
-    midiOut1Name.clear();
-    midiOut2Name.clear();
+    getTransport().releasePorts(this);
 }
 
 bool MidiRouter::arePortsOpen() const
 {
     // At minimum, we need both output ports to send commands
-    return (midiOut1 != nullptr && midiOut2 != nullptr);
+    return getTransport().areOutputsOpen();
+}
+
+bool MidiRouter::isConsoleKnownDown() const
+{
+    return getTransport().areOutputsOpen() && !getTransport().isConsoleLive();
 }
 
 juce::String MidiRouter::getPortStatusString() const
 {
-    juce::String status;
-    status << "IN1: " << (midiIn1 ? midiIn1Name : "None") << "\n";
-    status << "IN2: " << (midiIn2 ? midiIn2Name : "None") << "\n";
-    status << "OUT1: " << (midiOut1 ? midiOut1Name : "None") << "\n";
-    status << "OUT2: " << (midiOut2 ? midiOut2Name : "None");
-    return status;
+    return getTransport().getPortStatusString();
 }
 
 //==============================================================================
-// MIDI Output
+// Host MIDI Bus
 
-void MidiRouter::sendMidiCC(int midiChannel, int ccNumber, int value, int portIndex)
+void MidiRouter::setUsingHostMidiBus(bool shouldUseHostBus)
 {
-    // Safety check: ensure ports are open
-    if (portIndex == 1 && !midiOut1)
-        return;
-    if (portIndex == 2 && !midiOut2)
+    auto* target = shouldUseHostBus ? static_cast<ConsoleTransport*>(&hostTransport) : deviceTransport;
+    auto* previous = transport.load();
+    
+    if (target == previous)
         return;
     
-    juce::MidiMessage msg = juce::MidiMessage::controllerEvent(midiChannel, ccNumber, value);
+    // Input stops arriving from the old route before it starts on the new one
+    previous->releasePorts(this);
+    previous->removeClient(this);
+    target->addClient(this);
+    transport = target;
+    
+    // Whatever is on the other end hasn't seen anything sent so far
+    requestCacheClear();
+}
+
+//==============================================================================
+// Channel Ownership
+
+void MidiRouter::setOwnedChannels(int firstChannel, int lastChannel, bool ownsMaster)
+{
+    firstOwnedChannel = juce::jlimit(0, Layout::numChannels - 1, firstChannel);
+    lastOwnedChannel = juce::jlimit(firstOwnedChannel.load(), Layout::numChannels - 1, lastChannel);
+    masterSectionOwned = ownsMaster;
     
-    if (portIndex == 1 && midiOut1)
-        midiOut1->sendMessageNow(msg);
-    else if (portIndex == 2 && midiOut2)
-        midiOut2->sendMessageNow(msg);
+    // Newly owned controls must be sent on the next update
+    requestCacheClear();
+}
+
+bool MidiRouter::ownsParameter(int paramIndex) const noexcept
+{
+    int channel = Layout::channelOfParameter(paramIndex);
+    
+    if (channel < 0)
+        return masterSectionOwned.load();
+    
+    return channel >= firstOwnedChannel.load() && channel <= lastOwnedChannel.load();
+}
+
+//==============================================================================
+// MIDI Output
+
+void MidiRouter::sendMidiCC(int midiChannel, int ccNumber, int value, int portIndex)
+{
+    // Sent in order with everything else queued this way (commands, AUX mutes)
+    PipelineTrace::instant(PipelineTrace::Stage::queue, -1, value);
+    getTransport().sendOrdered(portIndex, juce::MidiMessage::controllerEvent(midiChannel, ccNumber, value));
+    telemetry.countSent(portIndex, -1, 1, 3);
+    captureOutgoing(portIndex, midiChannel, ccNumber, value, false);
 }
 
 void MidiRouter::sendFaderValue(int midiChannel, int ccPair, float normalizedValue, int portIndex)
 {
-    // Convert 0.0-1.0 to 14-bit MIDI (0-16383)
-    int value14bit = floatToMidi14Bit(normalizedValue);
+    // Convert 0.0-1.0 to 14-bit MIDI (0-16383); MSB on CC, LSB on CC+1.
+    // Coalesced: a fader that moves faster than the line only sends its latest position
+    int value14Bit = quantiseFader(CinemixCodec::encodeValue(Layout::Kind::fader, -1, normalizedValue));
+    PipelineTrace::instant(PipelineTrace::Stage::queue, -1, value14Bit);
+    getTransport().sendFaderValue(portIndex, midiChannel, ccPair, ccPair + 1, value14Bit);
+    telemetry.countSent(portIndex, -1, 2, 6);
+    captureOutgoing(portIndex, midiChannel, ccPair, value14Bit, true);
+}
+
+void MidiRouter::sendMidiBuffer(int portIndex, const juce::MidiBuffer& buffer,
+                                double startTimeMs, double sampleRate)
+{
+    if (buffer.isEmpty())
+        return;
     
-    // Split into MSB (CC) and LSB (CC+1)
-    int msb = (value14bit >> 7) & 0x7F;  // Upper 7 bits
-    int lsb = value14bit & 0x7F;          // Lower 7 bits
+    getTransport().sendBlock(portIndex, buffer, startTimeMs, sampleRate);
     
-    // Send both CCs
-    sendMidiCC(midiChannel, ccPair, msb, portIndex);
-    sendMidiCC(midiChannel, ccPair + 1, lsb, portIndex);
+    int numMessages = 0, numBytes = 0;
+    
+    for (const auto metadata : buffer)
+    {
+        ++numMessages;
+        numBytes += metadata.numBytes;
+    }
+    
+    telemetry.countSent(portIndex, -1, numMessages, numBytes);
+    
+    // Captured when queued rather than when each message is due
+    if (traffic.isCapturing())
+        for (const auto metadata : buffer)
+            if (metadata.numBytes >= 3 && (metadata.data[0] & 0xF0) == 0xB0)
+                captureOutgoing(portIndex, (metadata.data[0] & 0x0F) + 1, metadata.data[1], metadata.data[2], false);
 }
 
 void MidiRouter::sendParameterUpdate(int paramIndex, float value)
 {
-    if (paramIndex < 0 || paramIndex >= 161)
+    clearCacheIfRequested();
+    
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    const auto* entry = table.getEntry(paramIndex);
+    
+    if (entry == nullptr || !ownsParameter(paramIndex))
         return;
     
-    const MidiMapping& mapping = parameterMappings[paramIndex];
+    int encodedValue = table.encode(paramIndex, value);
     
-    if (mapping.isFader)
+    if (entry->midi.isFader())
+        encodedValue = quantiseFader(encodedValue);
+    
+    // Check if value changed (prevent duplicates); AUX mutes all share
+    // CC#96, so they are always sent (and never coalesced)
+    if (!table.getEncoding().alwaysSend[(size_t) paramIndex] && previousMidiValues[paramIndex] == encodedValue)
     {
-        // Fader: 14-bit dual CC
-        int value14bit = floatToMidi14Bit(value);
-        
-        // Check if value changed (prevent duplicates)
-        if (previousMidiValues[paramIndex] == value14bit)
-            return;
-        
-        previousMidiValues[paramIndex] = value14bit;
-        sendFaderValue(mapping.midiChannel, mapping.ccNumber, value, mapping.portIndex);
+        telemetry.countDeduplicated();
+        return;
     }
-    else
+    
+    // The host following a console move: the console already shows it
+    if (isConsoleEcho(paramIndex, encodedValue))
+    {
+        previousMidiValues[paramIndex] = (juce::int16) encodedValue;
+        telemetry.countSuppressedEcho();
+        return;
+    }
+    
+    sendEncodedValue(paramIndex, entry->midi, encodedValue);
+}
+
+void MidiRouter::sendParameterValues(const std::array<float, CinemixConsole::totalParameters>& parameterValues,
+                                     const ParameterMirror::Mask& parameters)
+{
+    constexpr int numParameters = Layout::totalParameters;
+    const PipelineTrace::Span traceSpan(PipelineTrace::Stage::encode);
+    
+    clearCacheIfRequested();
+    
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    const auto& encoding = table.getEncoding();
+    
+    // Pass 1: quantise the whole vector (see MidiMappingTable::Encoding).
+    // Clipping and scaling use JUCE's SIMD vector operations; the conversion
+    // is straight-line code the compiler vectorises
+    alignas(64) std::array<float, numParameters> scaled;
+    juce::FloatVectorOperations::clip(scaled.data(), parameterValues.data(), 0.0f, 1.0f, numParameters);
+    juce::FloatVectorOperations::multiply(scaled.data(), encoding.scales.data(), numParameters);
+    
+    alignas(64) std::array<juce::int32, numParameters> encoded;
+    
+    for (int i = 0; i < numParameters; ++i)
+        encoded[(size_t) i] = encoding.offsets[(size_t) i] + (juce::int32) scaled[(size_t) i];
+    
+    // Faders at a coarser resolution: moves within one step compare equal below
+    if (faderResolution.load(std::memory_order_relaxed) < CinemixCodec::fullFaderResolution)
+        for (int i = 0; i < numParameters; ++i)
+            if (encoding.isFader[(size_t) i] != 0)
+                encoded[(size_t) i] = quantiseFader(encoded[(size_t) i]);
+    
+    // Pass 2: compare with what the console was last sent
+    alignas(64) std::array<juce::uint8, numParameters> differs;
+    
+    for (int i = 0; i < numParameters; ++i)
+        differs[(size_t) i] = (juce::uint8) (encoding.isMapped[(size_t) i]
+                                             & ((encoded[(size_t) i] != previousMidiValues[(size_t) i]) | encoding.alwaysSend[(size_t) i]));
+    
+    // Pass 3: compact the requested parameters that differ into a list of indices
+    std::array<juce::int16, numParameters> changed;
+    int numChanged = 0, numRequested = 0;
+    
+    parameters.forEach([&](int paramIndex)
     {
-        // Button/Switch: single CC with specific encoding
-        int midiValue;
+        changed[(size_t) numChanged] = (juce::int16) paramIndex;
+        numChanged += differs[(size_t) paramIndex];
+        numRequested += encoding.isMapped[(size_t) paramIndex];
+    });
+    
+    if (numRequested > numChanged)
+        telemetry.countDeduplicated(numRequested - numChanged);
+    
+    // Only what's left touches the transport
+    for (int n = 0; n < numChanged; ++n)
+    {
+        int paramIndex = changed[(size_t) n];
+        int encodedValue = encoded[(size_t) paramIndex];
         
-        // Handle special cases
-        if (paramIndex >= 72 && paramIndex <= 143)
-        {
-            // Mute buttons: 2=OFF, 3=ON
-            midiValue = (value > 0.5f) ? 3 : 2;
-        }
-        else if (paramIndex >= 144 && paramIndex <= 153)
-        {
-            // AUX Mutes: special encoding on CC#96
-            int auxIndex = paramIndex - 144;
-            midiValue = (value > 0.5f) ? (auxIndex * 2 + 3) : (auxIndex * 2 + 2);
-            
-            // AUX mutes all use CC#96 on Channel 5, Port 2
-            sendMidiCC(5, 96, midiValue, 2);
-            previousMidiValues[paramIndex] = midiValue;
-            return;
-        }
-        else if (paramIndex == 156 || paramIndex == 159)
-        {
-            // Joystick mutes: 2=OFF, 3=ON
-            midiValue = (value > 0.5f) ? 3 : 2;
-        }
-        else
+        if (!ownsParameter(paramIndex))
+            continue;
+        
+        // The host following a console move: the console already shows it
+        if (isConsoleEcho(paramIndex, encodedValue))
         {
-            // Joystick X/Y and Master Fader: 0-127
-            midiValue = floatToMidi7Bit(value);
+            previousMidiValues[(size_t) paramIndex] = (juce::int16) encodedValue;
+            telemetry.countSuppressedEcho();
+            continue;
         }
         
-        // Check if value changed
-        if (previousMidiValues[paramIndex] == midiValue)
-            return;
-        
-        previousMidiValues[paramIndex] = midiValue;
-        sendMidiCC(mapping.midiChannel, mapping.ccNumber, midiValue, mapping.portIndex);
+        sendEncodedValue(paramIndex, table.getEntry(paramIndex)->midi, encodedValue);
     }
 }
 
+void MidiRouter::sendEncodedValue(int paramIndex, const MidiMapping& mapping, int encodedValue)
+{
+    previousMidiValues[paramIndex] = (juce::int16) encodedValue;
+    
+    // Whatever the console reported before is out of date once this arrives
+    consoleValues[(size_t) paramIndex].store(-1, std::memory_order_relaxed);
+    
+    PipelineTrace::instant(PipelineTrace::Stage::queue, paramIndex, encodedValue);
+    
+    // AUX mutes all share one CC, so they are ordered rather than coalesced
+    if (mapping.kind == Layout::Kind::auxMute)
+        getTransport().sendOrdered(mapping.portIndex, juce::MidiMessage::controllerEvent(mapping.midiChannel, mapping.ccNumber, encodedValue));
+    else if (mapping.isFader())
+        getTransport().sendFaderValue(mapping.portIndex, mapping.midiChannel, mapping.ccNumber, mapping.ccNumber2, encodedValue);
+    else
+        getTransport().sendControllerValue(mapping.portIndex, mapping.midiChannel, mapping.ccNumber, encodedValue);
+    
+    telemetry.countSent(mapping.portIndex, paramIndex, mapping.isFader() ? 2 : 1, mapping.isFader() ? 6 : 3);
+    traffic.capture(true, mapping.portIndex, 0xB0 | ((mapping.midiChannel - 1) & 0x0F), mapping.ccNumber,
+                    encodedValue, paramIndex, mapping.isFader());
+}
+
+int MidiRouter::createParameterMessages(int paramIndex, float value,
+                                        std::array<juce::MidiMessage, 2>& messages,
+                                        int& portIndex) const
+{
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    const auto* entry = table.getEntry(paramIndex);
+    
+    if (entry == nullptr)
+        return 0;
+    
+    // Faders: MSB on the primary CC, then LSB on the secondary CC
+    juce::uint8 bytes[CinemixCodec::maxBytesPerParameter];
+    int numBytes = CinemixCodec::encodeMessage(entry->midi, entry->auxSlot, value, bytes, (int) sizeof(bytes));
+    portIndex = entry->midi.portIndex;
+    
+    for (int i = 0; i < numBytes / 3; ++i)
+        messages[(size_t) i] = juce::MidiMessage(bytes + i * 3, 3);
+    
+    return numBytes / 3;
+}
+
 void MidiRouter::sendActivateCommand()
 {
     // Send CC#127, Value 127, Channel 5 to both ports
@@ -247,14 +363,23 @@ void MidiRouter::sendDeactivateCommand()
     // Send System Reset (0xFF) to both ports
     juce::MidiMessage resetMsg(0xFF);
     
-    if (midiOut1)
-        midiOut1->sendMessageNow(resetMsg);
-    if (midiOut2)
-        midiOut2->sendMessageNow(resetMsg);
+    getTransport().sendOrdered(1, resetMsg);
+    getTransport().sendOrdered(2, resetMsg);
+    telemetry.countSent(1, -1, 1, 1);
+    telemetry.countSent(2, -1, 1, 1);
+    getTransport().setConsoleLive(false);
+    
+    traffic.capture(true, 1, 0xFF, 0, 0, -1);
+    traffic.capture(true, 2, 0xFF, 0, 0, -1);
 }
 
 void MidiRouter::sendInitializationSequence()
 {
+    // Another instance (or the bridge daemon, across a host restart) already
+    // brought the console up on these ports
+    if (getTransport().isConsoleLive())
+        return;
+    
     // Console initialization sequence per original protocol:
     // 1. CC# 127, Val: 127, Ch. 5 (both ports)
     sendMidiCC(5, 127, 127, 1);
@@ -280,337 +405,330 @@ void MidiRouter::sendInitializationSequence()
     // 5. CC# 65, Val: 15, Ch. 5 (both ports)
     sendMidiCC(5, 65, 15, 1);
     sendMidiCC(5, 65, 15, 2);
+    
+    getTransport().setConsoleLive(true);
 }
 
-void MidiRouter::sendFullSnapshot(const std::array<float, 161>& parameterValues)
+void MidiRouter::sendFullSnapshot(const std::array<float, CinemixConsole::totalParameters>& parameterValues)
 {
     // Clear cache to force all values to send
     clearMidiCache();
     
-    // Send all parameter updates
-    for (int i = 0; i < 161; ++i)
-    {
-        sendParameterUpdate(i, parameterValues[i]);
-    }
+    // Send all parameter updates, encoded in one batch
+    sendParameterValues(parameterValues, ParameterMirror::Mask::all());
 }
 
 //==============================================================================
 // MIDI Input
 
-void MidiRouter::handleIncomingMidiMessage(juce::MidiInput* source, 
-                                            const juce::MidiMessage& message)
+void MidiRouter::handleConsoleMessage(int portIndex, const juce::MidiMessage& message)
 {
+    CINEMIX_RT_AUDIT_SCOPE("MidiRouter::handleConsoleMessage");
+    
     if (!message.isController())
+    {
+        telemetry.countReceived(portIndex, -1, message.getRawDataSize());
+        
+        if (traffic.isCapturing() && message.getRawDataSize() <= 3)
+        {
+            const auto* data = message.getRawData();
+            int size = message.getRawDataSize();
+            traffic.capture(false, portIndex, data[0], size > 1 ? data[1] : 0, size > 2 ? data[2] : 0, -1);
+        }
+        
         return;
-    
-    // Determine which port this came from
-    int portIndex = (source == midiIn1.get()) ? 1 : 2;
+    }
     
     int channel = message.getChannel();
     int ccNumber = message.getControllerNumber();
     int value = message.getControllerValue();
     
-    // Find parameter index from MIDI message
-    int paramIndex = findParameterIndex(channel, ccNumber, portIndex);
+    // Find parameter index from MIDI message (dense reverse table)
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    auto decoded = decodeController(table, portIndex, channel, ccNumber, value);
     
-    if (paramIndex >= 0 && onParameterChangeFromConsole)
+    // The LSB refines the fader's last MSB to the full 14 bits (nothing if
+    // no MSB has arrived yet)
+    if (decoded.faderByte == DecodedController::faderLsb)
     {
-        const MidiMapping& mapping = parameterMappings[paramIndex];
+        auto& fader = faderInputs[(size_t) decoded.paramIndex];
+        fader.pendingMsb.store(-1);
         
-        if (mapping.isFader)
-        {
-            // For faders, we need to combine MSB and LSB
-            // This is a simplified version - full implementation would need
-            // to cache MSB values and wait for LSB
-            // For now, treat as 7-bit
-            float normalizedValue = midi7BitToFloat(value);
-            onParameterChangeFromConsole(paramIndex, normalizedValue);
-        }
+        auto msb = fader.lastMsb.load(std::memory_order_relaxed);
+        
+        if (msb >= 0)
+            decoded.value = CinemixCodec::decodeFaderValue((msb << 7) | (value & 0x7F));
         else
-        {
-            // Handle button/switch values
-            float normalizedValue = 0.0f;
-            
-            // Special handling for mutes (values 2/3)
-            if (paramIndex >= 72 && paramIndex <= 143)
-            {
-                // Mute buttons: 2=OFF, 3=ON
-                normalizedValue = (value == 3) ? 1.0f : 0.0f;
-            }
-            else if (paramIndex >= 144 && paramIndex <= 153)
-            {
-                // AUX mutes: special encoding
-                int auxIndex = paramIndex - 144;
-                int expectedOn = auxIndex * 2 + 3;
-                normalizedValue = (value == expectedOn) ? 1.0f : 0.0f;
-            }
-            else if (paramIndex == 156 || paramIndex == 159)
-            {
-                // Joystick mutes: 2=OFF, 3=ON
-                normalizedValue = (value == 3) ? 1.0f : 0.0f;
-            }
-            else
-            {
-                // Joystick X/Y: standard 0-127
-                normalizedValue = midi7BitToFloat(value);
-            }
-            
-            onParameterChangeFromConsole(paramIndex, normalizedValue);
-        }
+            decoded.paramIndex = -1;
     }
-}
-
-//==============================================================================
-// Duplicate Prevention
-
-void MidiRouter::clearMidiCache()
-{
-    previousMidiValues.fill(-1);
-}
-
-//==============================================================================
-// Mapping Table Initialization
-
-void MidiRouter::initializeMappingTable()
-{
-    mapFaders_Channels1_24();
-    mapFaders_Channels25_36();
-    mapFaders_LowerRow();
-    mapMutes_Channels1_24();
-    mapMutes_Channels25_36();
-    mapMutes_LowerRow();
-    mapAuxMutes();
-    mapMasterSection();
-}
-
-void MidiRouter::mapFaders_Channels1_24()
-{
-    // Parameters 0-23: Upper faders for Channels 1-24 (Port 1, LOW section)
-    // MIDI: CC pairs 0-47, Channel 1
     
-    for (int i = 0; i < 24; ++i)
+    // Device time, where the transport kept it; otherwise it's just arrived
+    auto timeMs = message.getTimeStamp() > 0.0 ? message.getTimeStamp() * 1000.0
+                                                : juce::Time::getMillisecondCounterHiRes();
+    
+    telemetry.countReceived(portIndex, decoded.paramIndex, message.getRawDataSize());
+    PipelineTrace::instant(PipelineTrace::Stage::decode, decoded.paramIndex,
+                           decoded.paramIndex >= 0 ? (juce::int32) (decoded.value * 16383.0f) : value);
+    
+    if (!decoded.isMapped)
+        telemetry.countDecodeMiss();
+    
+    traffic.capture(false, portIndex, message.getRawData()[0], ccNumber, value, decoded.paramIndex);
+    
+    // A fader's MSB waits for the LSB that normally follows, so the host gets
+    // one 14-bit move rather than a coarse step and then the fine value. One
+    // still waiting (its LSB never came) goes out at 7 bits first
+    if (decoded.faderByte == DecodedController::faderMsb)
     {
-        parameterMappings[i] = MidiMapping(
-            1,              // MIDI Channel 1
-            i * 2,          // CC pair starts at i*2 (0, 2, 4, ... 46)
-            i * 2 + 1,      // CC pair LSB
-            1,              // Port 1
-            true            // Is fader (14-bit)
-        );
+        auto& fader = faderInputs[(size_t) decoded.paramIndex];
+        fader.lastMsb.store((juce::int8) value, std::memory_order_relaxed);
+        
+        auto previousMsb = fader.pendingMsb.exchange(-1);
+        
+        if (previousMsb >= 0)
+            passOnConsoleValue(table, decoded.paramIndex, CinemixCodec::decodeValue(Layout::Kind::fader, previousMsb),
+                               fader.pendingTimeMs.load());
+        
+        fader.pendingTimeMs.store(timeMs);
+        fader.pendingMsb.store((juce::int8) value);
+        return;
     }
+    
+    if (decoded.paramIndex >= 0)
+        passOnConsoleValue(table, decoded.paramIndex, decoded.value, timeMs);
 }
 
-void MidiRouter::mapFaders_Channels25_36()
+void MidiRouter::passOnConsoleValue(const MidiMappingTable& table, int paramIndex, float value, double timeMs)
 {
-    // Parameters 24-35: Upper faders for Channels 25-36 (Port 2, HIGH section)
-    // MIDI: CC pairs 0-23, Channel 2
+    // The host will echo this back through its parameter; it needn't be sent.
+    // Faders are compared as they would be sent, at the current resolution
+    auto encoded = table.encode(paramIndex, value);
     
-    for (int i = 0; i < 12; ++i)
-    {
-        int paramIndex = 24 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            2,              // MIDI Channel 2
-            i * 2,          // CC pair starts at i*2 (0, 2, 4, ... 22)
-            i * 2 + 1,      // CC pair LSB
-            2,              // Port 2
-            true            // Is fader
-        );
-    }
+    if (table.getEncoding().isFader[(size_t) paramIndex] != 0)
+        encoded = quantiseFader(encoded);
+    
+    consoleValues[(size_t) paramIndex].store((juce::int16) encoded, std::memory_order_relaxed);
+    
+    // Another instance owns this channel
+    if (!ownsParameter(paramIndex) || !onParameterChangeFromConsole)
+        return;
+    
+    onParameterChangeFromConsole(paramIndex, value, timeMs);
 }
 
-void MidiRouter::mapFaders_LowerRow()
+void MidiRouter::passOnUnpairedFaderMsbs()
 {
-    // Parameters 36-71: Lower (Mix) faders for all 36 channels
-    // Channels 1-24: Port 1, Channel 1, CC pairs 48-95 (offset +48 from upper)
-    // Channels 25-36: Port 2, Channel 2, CC pairs 24-47 (offset +24 from upper)
+    auto nowMs = juce::Time::getMillisecondCounterHiRes();
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    const auto& encoding = table.getEncoding();
     
-    // Lower faders for Channels 1-24 (Param 36-59)
-    for (int i = 0; i < 24; ++i)
+    for (int i = 0; i < Layout::totalParameters; ++i)
     {
-        int paramIndex = 36 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            1,                  // MIDI Channel 1
-            48 + i * 2,         // CC pair: 48, 50, 52, ... 94
-            48 + i * 2 + 1,     // LSB
-            1,                  // Port 1
-            true                // Is fader
-        );
-    }
-    
-    // Lower faders for Channels 25-36 (Param 60-71)
-    for (int i = 0; i < 12; ++i)
-    {
-        int paramIndex = 60 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            2,                  // MIDI Channel 2
-            24 + i * 2,         // CC pair: 24, 26, 28, ... 46
-            24 + i * 2 + 1,     // LSB
-            2,                  // Port 2
-            true                // Is fader
-        );
+        auto& fader = faderInputs[(size_t) i];
+        
+        if (encoding.isFader[(size_t) i] == 0 || fader.pendingMsb.load() < 0
+            || nowMs - fader.pendingTimeMs.load() < faderLsbTimeoutMs)
+            continue;
+        
+        // Taken from the input thread, unless its LSB has just arrived
+        auto msb = fader.pendingMsb.exchange(-1);
+        
+        if (msb >= 0)
+            passOnConsoleValue(table, i, CinemixCodec::decodeValue(Layout::Kind::fader, msb), fader.pendingTimeMs.load());
     }
 }
 
-void MidiRouter::mapMutes_Channels1_24()
+MidiRouter::DecodedController MidiRouter::decodeController(const MidiMappingTable& table, int portIndex,
+                                                           int midiChannel, int ccNumber, int value) const
 {
-    // Parameters 72-95: Upper mutes for Channels 1-24
-    // MIDI: CC 0-23, Channel 3, Port 1, Values 2=OFF, 3=ON
+    auto input = table.findInput(portIndex, midiChannel, ccNumber);
+    DecodedController decoded;
     
-    for (int i = 0; i < 24; ++i)
+    if (input.paramIndex < 0)
+        return decoded;
+    
+    decoded.isMapped = true;
+    
+    switch (input.source)
     {
-        int paramIndex = 72 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            3,              // MIDI Channel 3
-            i,              // CC: 0, 1, 2, ... 23
-            -1,             // No second CC
-            1,              // Port 1
-            false           // Not a fader
-        );
+        case MidiMappingTable::InputSource::none:
+            decoded.isMapped = false;
+            return decoded;
+        
+        case MidiMappingTable::InputSource::faderLsb:
+            // Combined with the MSB by the caller
+            decoded.faderByte = DecodedController::faderLsb;
+            break;
+        
+        case MidiMappingTable::InputSource::extraController:
+            // Added controllers: plain 0-127 whatever the parameter
+            decoded.value = CinemixCodec::decodeValue(Layout::Kind::joystickAxis, value);
+            break;
+        
+        case MidiMappingTable::InputSource::sharedAuxMute:
+        {
+            // AUX mutes share CC#96 - the value says which one: (aux * 2) + 2/3
+            auto slot = CinemixCodec::getAuxSlot(value);
+            if (slot < 0)
+                return decoded;
+            
+            decoded.paramIndex = table.getAuxMuteParameter(slot);
+            decoded.value = CinemixCodec::decodeValue(Layout::Kind::auxMute, value);
+            return decoded;
+        }
+        
+        case MidiMappingTable::InputSource::console:
+        {
+            // Faders: the MSB alone, until the LSB arrives
+            auto kind = table.getEntry(input.paramIndex)->midi.kind;
+            decoded.value = CinemixCodec::decodeValue(kind, value);
+            
+            if (kind == Layout::Kind::fader)
+                decoded.faderByte = DecodedController::faderMsb;
+            
+            break;
+        }
     }
+    
+    decoded.paramIndex = input.paramIndex;
+    return decoded;
 }
 
-void MidiRouter::mapMutes_Channels25_36()
+void MidiRouter::captureOutgoing(int portIndex, int midiChannel, int ccNumber, int value, bool isFaderPair)
 {
-    // Parameters 96-107: Upper mutes for Channels 25-36
-    // MIDI: CC 0-11, Channel 4, Port 2, Values 2=OFF, 3=ON
+    if (!traffic.isCapturing())
+        return;
     
-    for (int i = 0; i < 12; ++i)
-    {
-        int paramIndex = 96 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            4,              // MIDI Channel 4
-            i,              // CC: 0, 1, 2, ... 11
-            -1,             // No second CC
-            2,              // Port 2
-            false           // Not a fader
-        );
-    }
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    auto paramIndex = decodeController(table, portIndex, midiChannel, ccNumber, isFaderPair ? 0 : value).paramIndex;
+    
+    traffic.capture(true, portIndex, 0xB0 | ((midiChannel - 1) & 0x0F), ccNumber, value, paramIndex, isFaderPair);
 }
 
-void MidiRouter::mapMutes_LowerRow()
+void MidiRouter::consoleReconnected(bool needsFullResync)
 {
-    // Parameters 108-143: Lower (Mix) mutes for all 36 channels
-    // Channels 1-24: Port 1, Channel 3, CC 24-47
-    // Channels 25-36: Port 2, Channel 4, CC 12-23
-    
-    // Lower mutes for Channels 1-24 (Param 108-131)
-    for (int i = 0; i < 24; ++i)
+    // Runs on the port watcher (or bridge) thread: the sent-value cache
+    // belongs to the sending thread, so only hand the work over
+    if (needsFullResync)
     {
-        int paramIndex = 108 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            3,              // MIDI Channel 3
-            24 + i,         // CC: 24, 25, 26, ... 47
-            -1,
-            1,              // Port 1
-            false
-        );
+        // Activation sends a full snapshot, which starts from a clear cache
+        if (onConsoleNeedsResync)
+            onConsoleNeedsResync();
+        
+        return;
     }
     
-    // Lower mutes for Channels 25-36 (Param 132-143)
-    for (int i = 0; i < 12; ++i)
-    {
-        int paramIndex = 132 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            4,              // MIDI Channel 4
-            12 + i,         // CC: 12, 13, 14, ... 23
-            -1,
-            2,              // Port 2
-            false
-        );
-    }
+    auxMuteResendPending = true;
 }
 
-void MidiRouter::mapAuxMutes()
+void MidiRouter::sendPendingReconnectMessages()
 {
-    // Parameters 144-153: AUX 1-10 mutes
-    // Special encoding: all use CC#96, Channel 5, Port 2
-    // Values: AUX n → Val (n-1)*2+2 for OFF, (n-1)*2+3 for ON
+    clearCacheIfRequested();
+    
+    if (!auxMuteResendPending.exchange(false))
+        return;
+    
+    // Coalesced values waited for the device, but AUX mutes are ordered
+    // messages and were dropped: send the last known state of each again
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
     
-    for (int i = 0; i < 10; ++i)
+    for (int i = 0; i < Layout::totalParameters; ++i)
     {
-        int paramIndex = 144 + i;
-        parameterMappings[paramIndex] = MidiMapping(
-            5,              // MIDI Channel 5
-            96,             // CC 96 (special shared CC)
-            -1,
-            2,              // Port 2
-            false
-        );
+        const auto* entry = table.getEntry(i);
+        int lastValue = previousMidiValues[i];
+        
+        if (entry != nullptr && entry->midi.kind == Layout::Kind::auxMute && lastValue >= 0 && ownsParameter(i))
+            sendMidiCC(entry->midi.midiChannel, entry->midi.ccNumber, lastValue, entry->midi.portIndex);
     }
 }
 
-void MidiRouter::mapMasterSection()
+//==============================================================================
+// Duplicate Prevention
+
+void MidiRouter::clearMidiCache()
 {
-    // Parameter 154: Joystick 1 X - CC#48, Ch 2, Port 2
-    parameterMappings[154] = MidiMapping(2, 48, -1, 2, false);
-    
-    // Parameter 155: Joystick 1 Y - CC#50, Ch 2, Port 2
-    parameterMappings[155] = MidiMapping(2, 50, -1, 2, false);
+    // First, so a request made while clearing is kept for the next send
+    cacheClearPending = false;
+    previousMidiValues.fill(-1);
     
-    // Parameter 156: Joystick 1 Mute - CC#24, Ch 4, Port 2, Val 2/3
-    parameterMappings[156] = MidiMapping(4, 24, -1, 2, false);
+    for (auto& value : consoleValues)
+        value.store(-1, std::memory_order_relaxed);
     
-    // Parameter 157: Joystick 2 X - CC#52, Ch 2, Port 2
-    parameterMappings[157] = MidiMapping(2, 52, -1, 2, false);
+    // Nothing can be assumed about the console's faders either (not set yet during construction)
+    if (auto* current = transport.load())
+        current->forgetSentFaderValues();
+}
+
+void MidiRouter::restoreConsoleState(const std::array<float, CinemixConsole::totalParameters>& parameterValues)
+{
+    auto remap = remappedTable.read();
+    const auto& table = remap ? *remap : MidiMappingTable::getDefault();
+    const auto& encoding = table.getEncoding();
     
-    // Parameter 158: Joystick 2 Y - CC#54, Ch 2, Port 2
-    parameterMappings[158] = MidiMapping(2, 54, -1, 2, false);
+    clearMidiCache();
     
-    // Parameter 159: Joystick 2 Mute - CC#26, Ch 4, Port 2, Val 2/3
-    parameterMappings[159] = MidiMapping(4, 26, -1, 2, false);
+    // Encoded exactly as sendParameterValues() would have sent them
+    for (int i = 0; i < Layout::totalParameters; ++i)
+    {
+        if (encoding.isMapped[(size_t) i] == 0 || encoding.alwaysSend[(size_t) i] != 0 || !ownsParameter(i))
+            continue;
+        
+        int encodedValue = table.encode(i, parameterValues[(size_t) i]);
+        
+        if (encoding.isFader[(size_t) i] != 0)
+            encodedValue = quantiseFader(encodedValue);
+        
+        previousMidiValues[(size_t) i] = (juce::int16) encodedValue;
+    }
     
-    // Parameter 160: Master Fader - CC#0+1, Ch 5, Port 2 (14-bit)
-    parameterMappings[160] = MidiMapping(5, 0, 1, 2, true);
+    getTransport().setConsoleLive(true);
 }
 
 //==============================================================================
-// Helper Methods
+// Fader Resolution
 
-int MidiRouter::floatToMidi14Bit(float normalizedValue) const
+void MidiRouter::setFaderResolution(int resolutionBits) noexcept
 {
-    // Convert 0.0-1.0 to 0-16383
-    return static_cast<int>(juce::jlimit(0.0f, 1.0f, normalizedValue) * 16383.0f);
+    faderResolution = juce::jlimit(CinemixCodec::minFaderResolution, CinemixCodec::fullFaderResolution, resolutionBits);
 }
 
-float MidiRouter::midi14BitToFloat(int midiValue14Bit) const
+//==============================================================================
+// Mapping
+
+bool MidiRouter::loadMappingFile(const juce::File& mappingFile, juce::String& errorMessage)
 {
-    // Convert 0-16383 to 0.0-1.0
-    return juce::jlimit(0, 16383, midiValue14Bit) / 16383.0f;
+    auto table = MidiMappingTable::loadFromFile(mappingFile, errorMessage);
+    if (table == nullptr)
+        return false;
+    
+    setMappingTable(std::move(table));
+    return true;
 }
 
-int MidiRouter::floatToMidi7Bit(float normalizedValue) const
+void MidiRouter::resetMapping()
 {
-    // Convert 0.0-1.0 to 0-127
-    return static_cast<int>(juce::jlimit(0.0f, 1.0f, normalizedValue) * 127.0f);
+    setMappingTable(nullptr);
 }
 
-float MidiRouter::midi7BitToFloat(int midiValue7Bit) const
+void MidiRouter::setMappingTable(std::unique_ptr<MidiMappingTable> newTable)
 {
-    // Convert 0-127 to 0.0-1.0
-    return juce::jlimit(0, 127, midiValue7Bit) / 127.0f;
+    remappedTable.update(std::move(newTable));
+    
+    // Controls may have moved - re-send everything on the next update
+    requestCacheClear();
 }
 
-int MidiRouter::findParameterIndex(int midiChannel, int ccNumber, int portIndex) const
+//==============================================================================
+// Monitoring
+
+void MidiRouter::getTelemetrySnapshot(BridgeTelemetry::Snapshot& snapshot) const
 {
-    // Search through all parameter mappings for matching MIDI message
-    for (int i = 0; i < 161; ++i)
-    {
-        const MidiMapping& mapping = parameterMappings[i];
-        
-        // Check if MIDI channel, CC, and port match
-        if (mapping.midiChannel == midiChannel && 
-            mapping.portIndex == portIndex)
-        {
-            // For faders, check primary CC (MSB)
-            if (mapping.isFader && mapping.ccNumber == ccNumber)
-                return i;
-            
-            // For non-faders, check CC number
-            if (!mapping.isFader && mapping.ccNumber == ccNumber)
-                return i;
-        }
-    }
+    telemetry.getSnapshot(snapshot);
     
-    return -1;  // No matching parameter found
+    for (int port = 1; port <= BridgeTelemetry::numPorts; ++port)
+        snapshot.queues[(size_t) (port - 1)] = getTransport().getQueueStats(port);
 }
-
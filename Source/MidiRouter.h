@@ -16,6 +16,18 @@
 
 #include <JuceHeader.h>
 #include <array>
+#include <atomic>
+#include "ConsoleLayout.h"
+#include "BridgeClient.h"
+#include "BridgeTelemetry.h"
+#include "ConsoleCodec.h"
+#include "HostMidiTransport.h"
+#include "MidiMappingTable.h"
+#include "MidiPortHub.h"
+#include "MidiTrafficCapture.h"
+#include "ParameterMirror.h"
+#include "RcuPointer.h"
+#include "RealtimeAudit.h"
 
 //==============================================================================
 /**
@@ -27,28 +39,46 @@
  * 
  * MIDI Protocol Summary:
  * - Port 1: Channels 1-24 (LOW section), MIDI channels 1 & 3
- * - Port 2: Channels 25-36 (HIGH section) + Master, MIDI channels 2, 4, 5
+ * - Port 2: Channels 25 and up (HIGH section) + Master, MIDI channels 2, 4, 5
+ * - The exact CC assignments come from ConsoleLayout (see CinemixConsole),
+ *   optionally remapped at runtime (see MidiMappingTable)
  * - Faders: 14-bit resolution (dual CC)
  * - Mutes: Values 2=OFF, 3=ON (not 0/127!)
  * - AUX Mutes: Special encoding on CC#96, Ch 5
+ *
+ * The devices themselves belong to the process-wide MidiPortHub, or to a
+ * bridge daemon if one is running (see BridgeDaemon), so several plugin
+ * instances can share one console. Alternatively the console traffic can go
+ * through the plugin's own MIDI bus and the host's routing (see
+ * HostMidiTransport). Each router owns a range of
+ * console channels (and optionally the master section): it only sends those
+ * parameters and only reports console moves for them.
  */
-class MidiRouter : public juce::MidiInputCallback
+class MidiRouter : public ConsoleTransport::Client
 {
 public:
     //==============================================================================
     MidiRouter();
+    
+    /** Uses the given transport instead of the devices (e.g. LoopbackTransport); it must outlive the router */
+    explicit MidiRouter(ConsoleTransport& customTransport);
+    
     ~MidiRouter() override;
     
     //==============================================================================
     // Device Management
     
-    /** Returns list of available MIDI input device names */
+    /**
+     * Returns list of available MIDI input device names. The list is kept up
+     * to date in the background, so this never blocks (but is empty until the
+     * first scan has finished, and with a bridge daemon, which picks its own).
+     */
     juce::StringArray getAvailableMidiInputs() const;
     
-    /** Returns list of available MIDI output device names */
+    /** Returns list of available MIDI output device names (see getAvailableMidiInputs) */
     juce::StringArray getAvailableMidiOutputs() const;
     
-    /** Opens MIDI ports by device index (-1 = don't open) */
+    /** Opens MIDI ports by device index (-1 = don't open), blocking until they're open */
     bool openMidiPorts(int inPort1Index, int inPort2Index, 
                        int outPort1Index, int outPort2Index);
     
@@ -58,9 +88,44 @@ public:
     /** Returns true if all required ports are open */
     bool arePortsOpen() const;
     
+    /**
+     * True if the ports are open but the console isn't initialised on them
+     * (closed, or lost long enough to have been power-cycled). With nothing
+     * open yet, nothing is known either way.
+     */
+    bool isConsoleKnownDown() const;
+    
     /** Returns status string for display */
     juce::String getPortStatusString() const;
     
+    //==============================================================================
+    // Host MIDI Bus
+    
+    /**
+     * Sends and receives console traffic through the plugin's MIDI bus
+     * (processBlock) instead of the devices. Switching releases the current
+     * ports and clears the MIDI cache, so the console needs activating again.
+     */
+    void setUsingHostMidiBus(bool shouldUseHostBus);
+    
+    bool isUsingHostMidiBus() const noexcept        { return transport.load() == &hostTransport; }
+    
+    /** The host bus transport, fed and drained by the processor's processBlock */
+    HostMidiTransport& getHostMidiBus() noexcept    { return hostTransport; }
+    
+    //==============================================================================
+    // Channel Ownership (several instances on one console)
+    
+    /** Sets the console channels (0-based, inclusive) this instance drives */
+    void setOwnedChannels(int firstChannel, int lastChannel, bool ownsMasterSection);
+    
+    int getFirstOwnedChannel() const noexcept   { return firstOwnedChannel.load(); }
+    int getLastOwnedChannel() const noexcept    { return lastOwnedChannel.load(); }
+    bool ownsMasterSection() const noexcept     { return masterSectionOwned.load(); }
+    
+    /** True if the parameter belongs to this instance's channels */
+    bool ownsParameter(int paramIndex) const noexcept;
+    
     //==============================================================================
     // MIDI Output (DAW → Console)
     
@@ -70,100 +135,245 @@ public:
     /** Sends dual CC for 14-bit fader value */
     void sendFaderValue(int midiChannel, int ccPair, float normalizedValue, int portIndex);
     
-    /** Sends parameter update based on parameter index (0-160) */
+    /**
+     * Queues a block of messages for timed delivery on one port. Event sample
+     * positions are relative to startTimeMs (Time::getMillisecondCounterHiRes).
+     */
+    void sendMidiBuffer(int portIndex, const juce::MidiBuffer& buffer,
+                        double startTimeMs, double sampleRate);
+    
+    /** Sends parameter update based on parameter index (see CinemixConsole) */
     void sendParameterUpdate(int paramIndex, float value);
     
+    /**
+     * Sends the given parameters from a full value vector, skipping values the
+     * console already has. The whole vector is encoded and compared against
+     * the last sent values in one pass without allocating, so this is cheap
+     * enough for every audio block (snapshots, scene morphs, automation).
+     */
+    void sendParameterValues(const std::array<float, CinemixConsole::totalParameters>& parameterValues,
+                             const ParameterMirror::Mask& parameters);
+    
     /** Sends activation command to console (CC#127, Val 127, Ch 5) */
     void sendActivateCommand();
     
     /** Sends deactivation command (0xFF system reset) */
     void sendDeactivateCommand();
     
-    /** Sends console initialization sequence */
+    /** Sends console initialization sequence (skipped if the console is already live) */
     void sendInitializationSequence();
     
     /** Sends current snapshot of all parameters to console */
-    void sendFullSnapshot(const std::array<float, 161>& parameterValues);
+    void sendFullSnapshot(const std::array<float, CinemixConsole::totalParameters>& parameterValues);
+    
+    /**
+     * Builds the console messages for a parameter value without sending them.
+     * Returns the number of messages written (2 for faders, 1 otherwise, 0 if invalid).
+     */
+    int createParameterMessages(int paramIndex, float value,
+                                std::array<juce::MidiMessage, 2>& messages, int& portIndex) const;
     
     //==============================================================================
     // MIDI Input (Console → DAW)
     
-    /** MidiInputCallback override - processes incoming MIDI messages */
-    void handleIncomingMidiMessage(juce::MidiInput* source, 
-                                    const juce::MidiMessage& message) override;
+    /** ConsoleTransport::Client override - processes incoming MIDI messages */
+    void handleConsoleMessage(int portIndex, const juce::MidiMessage& message) override;
+    
+    /**
+     * Sets callback for parameter changes from console. timeMs is when the
+     * message arrived from the device, on the Time::getMillisecondCounterHiRes()
+     * clock (see ConsoleTransport::Client).
+     */
+    std::function<void(int paramIndex, float value, double timeMs)> onParameterChangeFromConsole;
+    
+    /**
+     * ConsoleTransport::Client override - a lost output device came back.
+     * After a short outage only the AUX mutes need resending (everything else
+     * was held back by the transport), which is left to the next
+     * sendPendingReconnectMessages(); otherwise onConsoleNeedsResync is called.
+     */
+    void consoleReconnected(bool needsFullResync) override;
+    
+    /**
+     * A fader move is passed on once its LSB has arrived, as one 14-bit
+     * value. Call this regularly (the processor's timer does): an MSB whose
+     * LSB hasn't followed within faderLsbTimeoutMs is passed on at 7 bits.
+     */
+    void passOnUnpairedFaderMsbs();
+    
+    static constexpr double faderLsbTimeoutMs = 10.0;
+    
+    /** Resends the AUX mutes a reconnect asked for, if any (sending thread only) */
+    void sendPendingReconnectMessages();
+    
+    /**
+     * Called (on a background thread) when the console may have been
+     * power-cycled and needs the initialisation sequence and a full snapshot.
+     * Only leave a request for the sending thread here; don't send.
+     */
+    std::function<void()> onConsoleNeedsResync;
+    
+    //==============================================================================
+    // Fader Resolution
+    
+    /**
+     * Rounds fader values to 7-14 bits before sending (14 = full resolution).
+     * Moves smaller than one step aren't sent at all, and at 7 bits only the
+     * MSB goes out, so slow moves take far less of the line.
+     */
+    void setFaderResolution(int resolutionBits) noexcept;
     
-    /** Sets callback for parameter changes from console */
-    std::function<void(int paramIndex, float value)> onParameterChangeFromConsole;
+    int getFaderResolution() const noexcept    { return faderResolution.load(); }
     
     //==============================================================================
     // Duplicate Prevention
     
-    /** Clears all cached MIDI values (forces re-send on next update) */
+    /** Clears all cached MIDI values (forces re-send on next update); sending thread only */
     void clearMidiCache();
     
+    /** Has the sending thread clear the cache before its next send (any thread) */
+    void requestCacheClear() noexcept           { cacheClearPending = true; }
+    
+    /**
+     * Takes the console to be initialised and already showing these values,
+     * e.g. when resuming after a crash with the console left running, so the
+     * next update only sends what differs. Not for use while sending.
+     */
+    void restoreConsoleState(const std::array<float, CinemixConsole::totalParameters>& parameterValues);
+    
+    //==============================================================================
+    // Mapping
+    
+    /** Loads a mapping file (see MidiMappingTable); the current mapping is kept on error */
+    bool loadMappingFile(const juce::File& mappingFile, juce::String& errorMessage);
+    
+    /** Returns to the built-in console layout */
+    void resetMapping();
+    
+    /**
+     * Swaps in a new mapping table (nullptr = the built-in layout). MIDI input
+     * and output keep running on the old table until they're done with it;
+     * only the calling thread waits.
+     */
+    void setMappingTable(std::unique_ptr<MidiMappingTable> newTable);
+    
+    //==============================================================================
+    // Monitoring
+    
+    /** Everything this router sends and receives, while a monitor is open */
+    MidiTrafficCapture& getTrafficCapture() noexcept    { return traffic; }
+    
+    /** Reads this router's counters and its transport's queue figures, without locking */
+    void getTelemetrySnapshot(BridgeTelemetry::Snapshot& snapshot) const;
+    
 private:
     //==============================================================================
-    // MIDI Port Management
-    std::unique_ptr<juce::MidiInput> midiIn1;
-    std::unique_ptr<juce::MidiInput> midiIn2;
-    std::unique_ptr<juce::MidiOutput> midiOut1;
-    std::unique_ptr<juce::MidiOutput> midiOut2;
+    // MIDI Port Management: this process's devices, or the bridge daemon's.
+    // Chosen once at construction; both are shared with the other instances.
+    std::unique_ptr<juce::SharedResourcePointer<BridgeClient>> bridgeClient;
+    std::unique_ptr<juce::SharedResourcePointer<MidiPortHub>> portHub;
+    ConsoleTransport* deviceTransport = nullptr;
     
-    juce::String midiIn1Name;
-    juce::String midiIn2Name;
-    juce::String midiOut1Name;
-    juce::String midiOut2Name;
+    // This instance's own MIDI bus, when the host does the routing
+    HostMidiTransport hostTransport;
+    
+    // The one in use: deviceTransport or hostTransport (read from any thread)
+    std::atomic<ConsoleTransport*> transport { nullptr };
+    
+    ConsoleTransport& getTransport() const noexcept    { return *transport.load(); }
+    
+    std::atomic<int> firstOwnedChannel { 0 };
+    std::atomic<int> lastOwnedChannel { CinemixConsole::numChannels - 1 };
+    std::atomic<bool> masterSectionOwned { true };
     
     //==============================================================================
-    // MIDI Mapping Data Structure
-    struct MidiMapping
-    {
-        int midiChannel;     // MIDI channel (1-16)
-        int ccNumber;        // Primary CC number
-        int ccNumber2;       // Secondary CC for 14-bit (or -1 if not used)
-        int portIndex;       // Which output port: 1 or 2
-        bool isFader;        // true = fader (14-bit), false = button/switch
-        
-        MidiMapping() 
-            : midiChannel(1), ccNumber(0), ccNumber2(-1), 
-              portIndex(1), isFader(false) {}
-        
-        MidiMapping(int ch, int cc, int cc2, int port, bool fader)
-            : midiChannel(ch), ccNumber(cc), ccNumber2(cc2), 
-              portIndex(port), isFader(fader) {}
-    };
+    // Parameter <-> MIDI mapping: the compile-time layout plus any user remap
+    using Layout = CinemixConsole;
+    using MidiMapping = Layout::MidiMapping;
     
-    // Mapping table: index = parameter index (0-160)
-    std::array<MidiMapping, 161> parameterMappings;
+    // The user's remap, or nullptr for the built-in table every instance
+    // shares (MidiMappingTable::getDefault()) - nothing per instance
+    RcuPointer<MidiMappingTable> remappedTable;
     
     // Cache last sent MIDI values to prevent duplicates
     // For faders: stores 14-bit value (0-16383)
     // For buttons/switches: stores 7-bit value (0-127)
-    std::array<int, 161> previousMidiValues;
+    std::array<juce::int16, Layout::totalParameters> previousMidiValues;
     
-    //==============================================================================
-    // Initialization
-    void initializeMappingTable();
-    
-    // Mapping table builders for each section
-    void mapFaders_Channels1_24();    // Param 0-23: Upper faders Ch 1-24
-    void mapFaders_Channels25_36();   // Param 24-47: Upper faders Ch 25-36
-    void mapFaders_LowerRow();        // Param 48-71: Lower faders (Mix)
-    void mapMutes_Channels1_24();     // Param 72-95: Mutes Ch 1-24
-    void mapMutes_Channels25_36();    // Param 96-119: Mutes Ch 25-36
-    void mapMutes_LowerRow();         // Param 120-143: Mutes lower row
-    void mapAuxMutes();               // Param 144-153: AUX mutes
-    void mapMasterSection();          // Param 154-160: Joysticks + Master fader
+    // What the console last reported per parameter (encoded, -1 = nothing since
+    // the last send), so the host echoing a console move isn't sent back to it
+    std::array<std::atomic<juce::int16>, Layout::totalParameters> consoleValues;
+    
+    // Per fader: the last MSB received (-1 = none yet), for decoding its LSB,
+    // and an MSB still waiting for its LSB (-1 = none) with its arrival time
+    struct FaderInput
+    {
+        std::atomic<juce::int8> lastMsb { -1 };
+        std::atomic<juce::int8> pendingMsb { -1 };
+        std::atomic<double> pendingTimeMs { 0.0 };
+    };
+    
+    std::array<FaderInput, Layout::totalParameters> faderInputs;
+    
+    std::atomic<int> faderResolution { CinemixCodec::fullFaderResolution };
+    
+    // Set by consoleReconnected() for the sending thread
+    std::atomic<bool> auxMuteResendPending { false };
+    
+    // Set by requestCacheClear(): routing, ownership or mapping changed
+    std::atomic<bool> cacheClearPending { false };
+    
+    /** Sending thread: clears the cache first if another thread asked for it */
+    void clearCacheIfRequested()
+    {
+        if (cacheClearPending.load())
+            clearMidiCache();
+    }
+    
+    BridgeTelemetry telemetry;
+    
+    MidiTrafficCapture traffic;
     
     //==============================================================================
     // Helper methods
-    int floatToMidi14Bit(float normalizedValue) const;
-    float midi14BitToFloat(int midiValue14Bit) const;
-    int floatToMidi7Bit(float normalizedValue) const;
-    float midi7BitToFloat(int midiValue7Bit) const;
     
-    // Reverse lookup: MIDI message to parameter index
-    int findParameterIndex(int midiChannel, int ccNumber, int portIndex) const;
+    struct DecodedController
+    {
+        int paramIndex = -1;    // -1 = no parameter
+        float value = 0.0f;
+        bool isMapped = false;  // False for a controller the mapping doesn't know
+        
+        enum FaderByte { notFader, faderMsb, faderLsb };
+        FaderByte faderByte = notFader;
+    };
+    
+    /**
+     * Parameter and value a controller message on the console stands for.
+     * For a fader LSB the value is left for the caller to combine with the MSB.
+     */
+    DecodedController decodeController(const MidiMappingTable& table, int portIndex,
+                                       int midiChannel, int ccNumber, int value) const;
+    
+    /** Passes a decoded console value on to onParameterChangeFromConsole (if owned) */
+    void passOnConsoleValue(const MidiMappingTable& table, int paramIndex, float value, double timeMs);
+    
+    /** Captures an outgoing controller for the monitor, working out its parameter */
+    void captureOutgoing(int portIndex, int midiChannel, int ccNumber, int value, bool isFaderPair);
+    
+    /** True if the console itself last reported this value (see consoleValues) */
+    bool isConsoleEcho(int paramIndex, int encodedValue) const noexcept
+    {
+        return consoleValues[(size_t) paramIndex].load(std::memory_order_relaxed) == encodedValue;
+    }
+    
+    /** A 14-bit fader value rounded to the current resolution */
+    int quantiseFader(int value14Bit) const noexcept
+    {
+        return CinemixCodec::quantiseFaderValue(value14Bit, faderResolution.load(std::memory_order_relaxed));
+    }
+    
+    /** Queues an encoded value on the transport and captures it for the monitor */
+    void sendEncodedValue(int paramIndex, const MidiMapping& mapping, int encodedValue);
     
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiRouter)
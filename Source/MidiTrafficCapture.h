@@ -0,0 +1,122 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MidiTrafficCapture.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include "MpscQueue.h"
+
+//==============================================================================
+/**
+ * MidiTrafficCapture
+ *
+ * Tap on a router's console traffic for the MIDI monitor.
+ *
+ * While nobody is watching, capture() is one atomic load and a branch, and
+ * no ring is allocated. Once start() has been called, every message is
+ * pushed to a lock-free ring (from the audio, message and MIDI input
+ * threads alike), and the monitor drains it on the message thread. When
+ * the ring is full, messages are counted as dropped rather than waited for.
+ *
+ * The ring, once allocated, stays until the capture is destroyed, so a
+ * producer that saw it just before stop() can still safely push.
+ */
+class MidiTrafficCapture
+{
+public:
+    //==============================================================================
+    struct Event
+    {
+        double timeMs = 0.0;            // Time::getMillisecondCounterHiRes()
+        juce::int16 paramIndex = -1;    // Decoded parameter (see CinemixConsole), or -1
+        juce::int16 value = 0;          // Data byte 2, or the 14-bit value of a fader pair
+        juce::uint8 portIndex = 0;      // Console port (1-2)
+        juce::uint8 status = 0;         // MIDI status byte
+        juce::uint8 data1 = 0;          // Data byte 1 (the MSB controller of a fader pair)
+        juce::uint8 flags = 0;          // See outgoingFlag, faderPairFlag
+    };
+
+    static constexpr juce::uint8 outgoingFlag = 1;   // To the console (otherwise from it)
+    static constexpr juce::uint8 faderPairFlag = 2;  // value is 14-bit, sent as two controllers
+
+    static constexpr int ringSize = 4096;
+    using Ring = MpscQueue<Event, ringSize>;
+
+    //==============================================================================
+    MidiTrafficCapture() = default;
+
+    /** True while a monitor is open; check this before doing any work to build an event */
+    bool isCapturing() const noexcept   { return activeRing.load(std::memory_order_relaxed) != nullptr; }
+
+    /** Records one message. Safe from any thread; does nothing unless capturing. */
+    void capture(bool outgoing, int portIndex, int status, int data1, int value,
+                 int paramIndex, bool isFaderPair = false) noexcept
+    {
+        auto* ring = activeRing.load(std::memory_order_acquire);
+        if (ring == nullptr)
+            return;
+
+        Event event;
+        event.timeMs = juce::Time::getMillisecondCounterHiRes();
+        event.paramIndex = (juce::int16) paramIndex;
+        event.value = (juce::int16) value;
+        event.portIndex = (juce::uint8) portIndex;
+        event.status = (juce::uint8) status;
+        event.data1 = (juce::uint8) data1;
+        event.flags = (juce::uint8) ((outgoing ? outgoingFlag : 0) | (isFaderPair ? faderPairFlag : 0));
+
+        if (!ring->push(event))
+            numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    // Monitor side (message thread)
+
+    /** Starts capturing, allocating the ring the first time */
+    void start()
+    {
+        if (ring == nullptr)
+            ring = std::make_unique<Ring>();
+
+        activeRing.store(ring.get(), std::memory_order_release);
+    }
+
+    /** Stops capturing; events already in the ring can still be read */
+    void stop() noexcept
+    {
+        activeRing.store(nullptr, std::memory_order_release);
+    }
+
+    /** Takes the oldest captured event. Only one thread may read. */
+    bool read(Event& event) noexcept
+    {
+        return ring != nullptr && ring->pop(event);
+    }
+
+    /** Returns and resets the number of events lost to a full ring */
+    int takeNumDropped() noexcept
+    {
+        return numDropped.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    //==============================================================================
+    std::unique_ptr<Ring> ring;
+    std::atomic<Ring*> activeRing { nullptr };
+    std::atomic<int> numDropped { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (MidiTrafficCapture)
+};
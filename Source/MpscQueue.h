@@ -0,0 +1,118 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - MpscQueue.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+
+//==============================================================================
+/**
+ * MpscQueue
+ *
+ * Bounded, lock-free multi-producer / single-consumer queue.
+ *
+ * juce::AbstractFifo only supports one writer, but console input arrives on
+ * one MIDI callback thread per device, and outgoing traffic can come from the
+ * audio, message and UI threads. Each slot carries a sequence number, so
+ * producers claim a slot with one CAS and never wait on each other.
+ * push() fails (rather than blocks) when the queue is full.
+ *
+ * Capacity must be a power of two.
+ */
+template <typename ElementType, int Capacity>
+class MpscQueue
+{
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    //==============================================================================
+    MpscQueue()
+    {
+        for (juce::uint32 i = 0; i < (juce::uint32) Capacity; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /** Adds an element. Safe from any number of threads; returns false if full. */
+    bool push(const ElementType& element) noexcept
+    {
+        auto pos = writePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& slot = slots[pos & mask];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto diff = (juce::int32) (sequence - pos);
+
+            if (diff == 0)
+            {
+                if (writePosition.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.element = element;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;  // Full
+            }
+            else
+            {
+                pos = writePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /** Removes the oldest element. Must only be called from the single consumer thread. */
+    bool pop(ElementType& element) noexcept
+    {
+        auto pos = readPosition.load(std::memory_order_relaxed);
+        auto& slot = slots[pos & mask];
+
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+            return false;  // Empty (or the next element is still being written)
+
+        element = slot.element;
+        slot.sequence.store(pos + (juce::uint32) Capacity, std::memory_order_release);
+        readPosition.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /** Approximate number of queued elements (exact only when producers are idle) */
+    int getNumReady() const noexcept
+    {
+        return (int) (writePosition.load(std::memory_order_relaxed)
+                      - readPosition.load(std::memory_order_relaxed));
+    }
+
+    static constexpr int getCapacity() noexcept { return Capacity; }
+
+private:
+    //==============================================================================
+    struct Slot
+    {
+        std::atomic<juce::uint32> sequence { 0 };
+        ElementType element {};
+    };
+
+    static constexpr juce::uint32 mask = (juce::uint32) Capacity - 1;
+
+    std::array<Slot, Capacity> slots;
+    alignas(64) std::atomic<juce::uint32> writePosition { 0 };
+    alignas(64) std::atomic<juce::uint32> readPosition { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (MpscQueue)
+};
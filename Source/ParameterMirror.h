@@ -0,0 +1,235 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - ParameterMirror.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "ConsoleLayout.h"
+
+#if JUCE_MSVC
+ #include <intrin.h>
+#endif
+
+//==============================================================================
+/**
+ * ParameterMirror
+ *
+ * Every parameter value in one place, stored as a structure of arrays:
+ * continuous controls (faders, joystick axes, master) as floats, and
+ * switches (channel, AUX and joystick mutes) as bits. Each consumer has its
+ * own dirty mask with one bit per parameter.
+ *
+ * Writers call set(), which is a store and one fetch_or per consumer, from
+ * any thread. Each consumer (the MIDI sender, the editor) calls
+ * takeChanges() whenever it is ready. That swaps its mask for an empty one
+ * in a few word exchanges, so any number of changes to a parameter since
+ * the last call cost the consumer one visit. Values are written before
+ * their dirty bit, so a consumer always reads a value at least as new as
+ * the change that flagged it.
+ */
+class ParameterMirror
+{
+public:
+    //==============================================================================
+    using Layout = CinemixConsole;
+
+    static constexpr int numParameters = Layout::totalParameters;
+    static constexpr int numMaskWords = (numParameters + 63) / 64;
+
+    enum Consumer
+    {
+        midiOutput,
+        editor,
+        numConsumers
+    };
+
+    /** A set of parameters, one bit per index */
+    struct Mask
+    {
+        std::array<juce::uint64, numMaskWords> words {};
+
+        /** Every parameter */
+        static Mask all() noexcept
+        {
+            Mask mask;
+
+            for (int i = 0; i < numParameters; ++i)
+                mask.words[(size_t) (i >> 6)] |= (juce::uint64) 1 << (i & 63);
+
+            return mask;
+        }
+
+        bool isEmpty() const noexcept
+        {
+            for (auto word : words)
+                if (word != 0)
+                    return false;
+
+            return true;
+        }
+
+        /** Calls function(paramIndex) for each parameter in the set, in index order */
+        template <typename Function>
+        void forEach(Function&& function) const
+        {
+            for (int w = 0; w < numMaskWords; ++w)
+                for (auto bits = words[(size_t) w]; bits != 0; bits &= bits - 1)
+                    function(w * 64 + countTrailingZeros(bits));
+        }
+    };
+
+    //==============================================================================
+    ParameterMirror() noexcept
+    {
+        for (auto& value : continuousValues)
+            value.store(0.0f, std::memory_order_relaxed);
+
+        for (auto& word : switchBits)
+            word.store(0, std::memory_order_relaxed);
+
+        for (auto& mask : dirtyMasks)
+            for (auto& word : mask.words)
+                word.store(0, std::memory_order_relaxed);
+    }
+
+    /** True for on/off parameters (mutes), which are stored as bits */
+    static constexpr bool isSwitch(int paramIndex) noexcept
+    {
+        return (paramIndex >= Layout::muteStart && paramIndex <= Layout::auxMuteEnd)
+               || paramIndex == Layout::joy1Mute || paramIndex == Layout::joy2Mute;
+    }
+
+    /** Stores a normalised value and flags it for every consumer. Any thread. */
+    void set(int paramIndex, float value) noexcept
+    {
+        if (paramIndex < 0 || paramIndex >= numParameters)
+            return;
+
+        auto slot = slots[(size_t) paramIndex];
+
+        if (isSwitch(paramIndex))
+        {
+            auto bit = (juce::uint64) 1 << (slot & 63);
+
+            if (value >= 0.5f)
+                switchBits[(size_t) (slot >> 6)].fetch_or(bit, std::memory_order_relaxed);
+            else
+                switchBits[(size_t) (slot >> 6)].fetch_and(~bit, std::memory_order_relaxed);
+        }
+        else
+        {
+            continuousValues[(size_t) slot].store(value, std::memory_order_relaxed);
+        }
+
+        auto dirtyBit = (juce::uint64) 1 << (paramIndex & 63);
+
+        for (auto& mask : dirtyMasks)
+            mask.words[(size_t) (paramIndex >> 6)].fetch_or(dirtyBit, std::memory_order_release);
+    }
+
+    /** Latest normalised value (switches are 0 or 1). Any thread. */
+    float get(int paramIndex) const noexcept
+    {
+        if (paramIndex < 0 || paramIndex >= numParameters)
+            return 0.0f;
+
+        auto slot = slots[(size_t) paramIndex];
+
+        if (isSwitch(paramIndex))
+            return (switchBits[(size_t) (slot >> 6)].load(std::memory_order_relaxed) >> (slot & 63)) & 1 ? 1.0f : 0.0f;
+
+        return continuousValues[(size_t) slot].load(std::memory_order_relaxed);
+    }
+
+    /** Copies every value, e.g. for a snapshot or a scene */
+    void getValues(std::array<float, numParameters>& values) const noexcept
+    {
+        for (int i = 0; i < numParameters; ++i)
+            values[(size_t) i] = get(i);
+    }
+
+    /**
+     * Moves the consumer's pending changes into changes and clears them.
+     * Returns false if nothing changed. Only one thread per consumer.
+     */
+    bool takeChanges(Consumer consumer, Mask& changes) noexcept
+    {
+        auto& mask = dirtyMasks[(size_t) consumer];
+
+        for (int w = 0; w < numMaskWords; ++w)
+        {
+            auto& word = mask.words[(size_t) w];
+
+            // Most scans find nothing: skip the exchange (and the cache line write)
+            changes.words[(size_t) w] = word.load(std::memory_order_relaxed) != 0
+                                            ? word.exchange(0, std::memory_order_acquire)
+                                            : 0;
+        }
+
+        return !changes.isEmpty();
+    }
+
+private:
+    //==============================================================================
+    static int countTrailingZeros(juce::uint64 bits) noexcept
+    {
+       #if JUCE_MSVC
+        unsigned long index = 0;
+        _BitScanForward64(&index, bits);
+        return (int) index;
+       #else
+        return __builtin_ctzll(bits);
+       #endif
+    }
+
+    static constexpr int numSwitches = Layout::numMutes + Layout::numAuxMutes + 2;
+    static constexpr int numContinuous = numParameters - numSwitches;
+    static constexpr int numSwitchWords = (numSwitches + 63) / 64;
+
+    /** Where each parameter lives: its float slot, or its switch bit */
+    static constexpr std::array<juce::int16, numParameters> createSlots()
+    {
+        std::array<juce::int16, numParameters> result {};
+        int nextContinuous = 0, nextSwitch = 0;
+
+        for (int i = 0; i < numParameters; ++i)
+            result[(size_t) i] = (juce::int16) (isSwitch(i) ? nextSwitch++ : nextContinuous++);
+
+        return result;
+    }
+
+    static const std::array<juce::int16, numParameters> slots;
+
+    struct alignas(64) DirtyMask
+    {
+        std::array<std::atomic<juce::uint64>, numMaskWords> words;
+    };
+
+    alignas(64) std::array<std::atomic<float>, numContinuous> continuousValues;
+    alignas(64) std::array<std::atomic<juce::uint64>, numSwitchWords> switchBits;
+
+    // One cache line per consumer, so consumers don't disturb each other
+    std::array<DirtyMask, numConsumers> dirtyMasks;
+
+    JUCE_DECLARE_NON_COPYABLE (ParameterMirror)
+};
+
+// Defined out of the class, which has to be complete before createSlots() can run
+inline constexpr std::array<juce::int16, ParameterMirror::numParameters> ParameterMirror::slots = ParameterMirror::createSlots();
+
+static_assert(ParameterMirror::numParameters - (CinemixConsole::numMutes + CinemixConsole::numAuxMutes + 2)
+                  == CinemixConsole::numFaders + 5,
+              "Faders, four joystick axes and the master are the only continuous parameters");
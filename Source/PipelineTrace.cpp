@@ -0,0 +1,230 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - PipelineTrace.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "PipelineTrace.h"
+#include "ConsoleLayout.h"
+
+namespace
+{
+    //==============================================================================
+    constexpr int maxThreads = 32;
+    constexpr int eventsPerThread = 1 << 15;
+
+    struct Event
+    {
+        juce::int64 ticks;
+        juce::int32 value;
+        juce::int16 paramIndex;
+        PipelineTrace::Stage stage;
+        PipelineTrace::Detail::Phase phase;
+    };
+
+    static_assert(sizeof(Event) == 16, "Four trace events per cache line");
+
+    // Written only by the thread that claimed it; numEvents publishes each event
+    struct ThreadBuffer
+    {
+        juce::Thread::ThreadID threadId = nullptr;
+        std::atomic<int> numEvents { 0 };
+        Event events[eventsPerThread];
+    };
+
+    // Which buffer the calling thread has in the current capture
+    struct ThreadSlot
+    {
+        juce::uint32 generation = 0;
+        ThreadBuffer* buffer = nullptr;
+    };
+
+    // Constant-initialised, so reading it never allocates
+    thread_local ThreadSlot threadSlot;
+
+    // Allocated by the first start() and kept for the life of the process, so
+    // a thread that saw recording just before stop() can still safely write
+    std::unique_ptr<ThreadBuffer[]> buffers;
+    std::atomic<ThreadBuffer*> pool { nullptr };
+    std::atomic<int> numClaimed { 0 };
+    std::atomic<juce::uint32> generation { 0 };
+    std::atomic<juce::int64> numDropped { 0 };
+    juce::int64 startTicks = 0;
+}
+
+std::atomic<bool> PipelineTrace::Detail::recording { false };
+
+//==============================================================================
+const char* PipelineTrace::getStageName(Stage stage) noexcept
+{
+    switch (stage)
+    {
+        case Stage::hostChange:     return "host change";
+        case Stage::encode:         return "encode";
+        case Stage::queue:          return "queue";
+        case Stage::wireWrite:      return "wire write";
+        case Stage::consoleReceive: return "console receive";
+        case Stage::decode:         return "decode";
+        case Stage::hostNotify:     return "host notify";
+        case Stage::numStages:      break;
+    }
+
+    return "";
+}
+
+void PipelineTrace::Detail::record(Stage stage, Phase phase, int paramIndex, juce::int32 value) noexcept
+{
+    auto& slot = threadSlot;
+    auto currentGeneration = generation.load(std::memory_order_acquire);
+
+    // First event of this thread in this capture: claim a buffer
+    if (slot.generation != currentGeneration)
+    {
+        slot.generation = currentGeneration;
+        auto index = numClaimed.fetch_add(1);
+        slot.buffer = index < maxThreads ? pool.load(std::memory_order_acquire) + index : nullptr;
+
+        if (slot.buffer != nullptr)
+            slot.buffer->threadId = juce::Thread::getCurrentThreadId();
+    }
+
+    auto* buffer = slot.buffer;
+    auto count = buffer != nullptr ? buffer->numEvents.load(std::memory_order_relaxed) : eventsPerThread;
+
+    if (count >= eventsPerThread)
+    {
+        numDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer->events[count] = { juce::Time::getHighResolutionTicks(), value, (juce::int16) paramIndex, stage, phase };
+    buffer->numEvents.store(count + 1, std::memory_order_release);
+}
+
+//==============================================================================
+void PipelineTrace::start()
+{
+    if (isRecording())
+        return;
+
+    if (buffers == nullptr)
+    {
+        buffers.reset(new ThreadBuffer[maxThreads]);
+        pool.store(buffers.get(), std::memory_order_release);
+    }
+
+    for (int i = 0; i < maxThreads; ++i)
+        buffers[i].numEvents.store(0, std::memory_order_relaxed);
+
+    numClaimed = 0;
+    numDropped = 0;
+    startTicks = juce::Time::getHighResolutionTicks();
+
+    // Every thread claims a fresh buffer with its next event
+    generation.fetch_add(1, std::memory_order_release);
+    Detail::recording.store(true, std::memory_order_release);
+}
+
+void PipelineTrace::stop()
+{
+    Detail::recording.store(false, std::memory_order_release);
+}
+
+juce::int64 PipelineTrace::getNumDropped() noexcept
+{
+    return numDropped.load(std::memory_order_relaxed);
+}
+
+juce::File PipelineTrace::getDefaultTraceFolder()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+               .getChildFile("CinemixAutomationBridge")
+               .getChildFile("Traces");
+}
+
+//==============================================================================
+// Export
+
+bool PipelineTrace::writeChromeTrace(const juce::File& file)
+{
+    if (buffers == nullptr || isRecording())
+        return false;
+
+    if (file.getParentDirectory().createDirectory().failed())
+        return false;
+
+    juce::FileOutputStream output(file);
+    if (output.failedToOpen())
+        return false;
+
+    output.setPosition(0);
+    output.truncate();
+
+    auto microsecondsPerTick = 1.0e6 / (double) juce::Time::getHighResolutionTicksPerSecond();
+    auto messageThreadId = juce::MessageManager::getInstance()->getCurrentMessageThread();
+    auto numThreads = juce::jmin(numClaimed.load(), maxThreads);
+    bool isFirst = true;
+
+    auto writeEvent = [&output, &isFirst](const juce::String& json)
+    {
+        output << (isFirst ? "\n" : ",\n") << json;
+        isFirst = false;
+    };
+
+    output << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":" << juce::String(getNumDropped()) << "},\"traceEvents\":[";
+
+    for (int i = 0; i < numThreads; ++i)
+    {
+        const auto& buffer = buffers[i];
+        auto count = buffer.numEvents.load(std::memory_order_acquire);
+        auto tid = juce::String(i + 1);
+
+        if (count == 0)
+            continue;
+
+        // Named after the message thread, or the first stage seen on the thread
+        auto threadName = buffer.threadId == messageThreadId
+                            ? juce::String("Message thread")
+                            : "Thread " + tid + " (" + getStageName(buffer.events[0].stage) + ")";
+
+        writeEvent("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid
+                   + ",\"args\":{\"name\":\"" + threadName + "\"}}");
+
+        for (int n = 0; n < count; ++n)
+        {
+            const auto& event = buffer.events[n];
+            auto isMidi = event.stage == Stage::wireWrite || event.stage == Stage::consoleReceive;
+
+            juce::String args;
+
+            if (isMidi)
+                args << "\"midi\":\"" << juce::String::toHexString((event.value >> 16) & 0xFF) << " "
+                     << juce::String::toHexString((event.value >> 8) & 0xFF) << " "
+                     << juce::String::toHexString(event.value & 0xFF) << "\"";
+            else if (event.paramIndex >= 0 && event.paramIndex < CinemixConsole::totalParameters)
+                args << "\"param\":\"" << CinemixConsole::getParameterID(event.paramIndex) << "\",\"value\":" << event.value;
+            else
+                args << "\"value\":" << event.value;
+
+            auto phase = event.phase == Detail::Phase::begin ? "B" : (event.phase == Detail::Phase::end ? "E" : "i");
+            auto timeMicros = (double) (event.ticks - startTicks) * microsecondsPerTick;
+
+            writeEvent(juce::String("{\"name\":\"") + getStageName(event.stage) + "\",\"cat\":\"pipeline\",\"ph\":\"" + phase
+                       + "\"" + (event.phase == Detail::Phase::instant ? ",\"s\":\"t\"" : "")
+                       + ",\"ts\":" + juce::String(timeMicros, 3) + ",\"pid\":1,\"tid\":" + tid
+                       + ",\"args\":{" + args + "}}");
+        }
+    }
+
+    output << "\n]}\n";
+    output.flush();
+    return output.getStatus().wasOk();
+}
@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - PipelineTrace.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+
+//==============================================================================
+/**
+ * PipelineTrace
+ *
+ * Records every step a value takes between the host and the console, with
+ * high-resolution timestamps and the thread it ran on, for a time window
+ * started and stopped at runtime:
+ *
+ *   host change -> encode -> queue -> wire write       (to the console)
+ *   console receive -> decode -> host notify           (from the console)
+ *
+ * The trace is written as Chrome trace-event JSON, which chrome://tracing,
+ * Perfetto and similar viewers open directly: a stall shows up as a gap on
+ * the host's thread, ours, or the MIDI driver's.
+ *
+ * While not recording, each trace point is one relaxed load and a branch.
+ * While recording, each thread writes into its own buffer, taken from a
+ * pool allocated by the first start() - no locks or allocations on the
+ * audio and MIDI threads. Events past a buffer's end, and threads beyond
+ * the pool, are counted as dropped.
+ *
+ * One trace covers the whole process (every plugin instance and the port
+ * hub). start(), stop() and writeChromeTrace() belong on the message thread.
+ */
+namespace PipelineTrace
+{
+    enum class Stage : juce::uint8
+    {
+        hostChange,         // The host set a parameter
+        encode,             // A batch of parameters encoded and compared (span)
+        queue,              // A value or command handed to the transport
+        wireWrite,          // Bytes given to the MIDI driver or the host's MIDI bus
+        consoleReceive,     // Bytes from the MIDI driver or the host's MIDI bus
+        decode,             // A console message decoded to a parameter
+        hostNotify,         // The host told about a console move (span)
+        numStages
+    };
+
+    /** The short name a stage has in the trace */
+    const char* getStageName(Stage stage) noexcept;
+
+    namespace Detail
+    {
+        extern std::atomic<bool> recording;
+
+        enum class Phase : juce::uint8 { instant, begin, end };
+
+        void record(Stage stage, Phase phase, int paramIndex, juce::int32 value) noexcept;
+    }
+
+    //==============================================================================
+    /** True between start() and stop() */
+    inline bool isRecording() noexcept     { return Detail::recording.load(std::memory_order_relaxed); }
+
+    /** Marks a point: a parameter (-1 for none) and its value (normalised values as 0-16383) */
+    inline void instant(Stage stage, int paramIndex = -1, juce::int32 value = 0) noexcept
+    {
+        if (isRecording())
+            Detail::record(stage, Detail::Phase::instant, paramIndex, value);
+    }
+
+    /** Marks a point for raw MIDI bytes (1-3) */
+    inline void midi(Stage stage, const juce::uint8* data, int size) noexcept
+    {
+        if (isRecording())
+            Detail::record(stage, Detail::Phase::instant, -1,
+                           (juce::int32) ((size > 0 ? data[0] << 16 : 0) | (size > 1 ? data[1] << 8 : 0) | (size > 2 ? data[2] : 0)));
+    }
+
+    /** Marks the time from construction to destruction */
+    class Span
+    {
+    public:
+        explicit Span(Stage spanStage, int spanParamIndex = -1, juce::int32 spanValue = 0) noexcept
+            : stage(spanStage), paramIndex(spanParamIndex), value(spanValue), active(isRecording())
+        {
+            if (active)
+                Detail::record(stage, Detail::Phase::begin, paramIndex, value);
+        }
+
+        ~Span() noexcept
+        {
+            if (active)
+                Detail::record(stage, Detail::Phase::end, paramIndex, value);
+        }
+
+    private:
+        const Stage stage;
+        const int paramIndex;
+        const juce::int32 value;
+        const bool active;
+
+        JUCE_DECLARE_NON_COPYABLE (Span)
+    };
+
+    //==============================================================================
+    /** Clears the previous capture and starts recording */
+    void start();
+
+    /** Stops recording; the capture stays until the next start() */
+    void stop();
+
+    /** Number of events that didn't fit in the current or last capture */
+    juce::int64 getNumDropped() noexcept;
+
+    /** Writes the last capture (stop() it first) as Chrome trace-event JSON */
+    bool writeChromeTrace(const juce::File& file);
+
+    /** Returns the folder traces are saved to by default */
+    juce::File getDefaultTraceFolder();
+}
@@ -14,18 +14,77 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "PipelineTrace.h"
 
 //==============================================================================
 CinemixBridgeEditor::CinemixBridgeEditor (CinemixBridgeProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
+    : AudioProcessorEditor (&p), audioProcessor (p),
+      consoleView (p.getParameters(), p.getParameterMirror()),
+      telemetryView ([&p](BridgeTelemetry::Snapshot& snapshot) { p.getMidiRouter().getTelemetrySnapshot(snapshot); },
+                     ConsoleViewComponent::stripWidth)
 {
-    // Set fixed window size (as per PLAN.md)
-    setSize (920, 560);
+    addAndMakeVisible(consoleView);
+    addAndMakeVisible(telemetryView);
     
-    // Phase 5: Create and display a single channel strip for testing
-    // Using channel 0 (M1) as test channel
-    channelStrip = std::make_unique<ChannelStripComponent>(audioProcessor.getAPVTS(), 0);
-    addAndMakeVisible(*channelStrip);
+    monitorButton.setClickingTogglesState(true);
+    monitorButton.onClick = [this] { toggleMonitor(); };
+    addAndMakeVisible(monitorButton);
+    
+    hostMidiBusButton.setToggleState(p.getMidiRouter().isUsingHostMidiBus(), juce::dontSendNotification);
+    hostMidiBusButton.onClick = [this]
+    {
+        audioProcessor.setUsingHostMidiBus(hostMidiBusButton.getToggleState());
+    };
+    addAndMakeVisible(hostMidiBusButton);
+    
+    telemetryLogButton.setToggleState(p.isTelemetryLogging(), juce::dontSendNotification);
+    telemetryLogButton.onClick = [this]
+    {
+        audioProcessor.setTelemetryLogging(telemetryLogButton.getToggleState());
+    };
+    addAndMakeVisible(telemetryLogButton);
+    
+    // Item IDs are the resolution in bits
+    for (int bits : { 14, 12, 10, 8, 7 })
+        faderResolutionBox.addItem("Faders: " + juce::String(bits) + "-bit", bits);
+    
+    faderResolutionBox.setSelectedId(p.getMidiRouter().getFaderResolution(), juce::dontSendNotification);
+    faderResolutionBox.onChange = [this]
+    {
+        audioProcessor.getMidiRouter().setFaderResolution(faderResolutionBox.getSelectedId());
+    };
+    addAndMakeVisible(faderResolutionBox);
+    
+    timedCaptureButton.setToggleState(p.getConsoleCapture().isEnabled(), juce::dontSendNotification);
+    timedCaptureButton.onClick = [this]
+    {
+        audioProcessor.getConsoleCapture().setEnabled(timedCaptureButton.getToggleState());
+    };
+    addAndMakeVisible(timedCaptureButton);
+    
+    captureOffsetSlider.setSliderStyle(juce::Slider::LinearBar);
+    captureOffsetSlider.setRange(0.0, ConsoleCapture::maxOffsetMs, 0.5);
+    captureOffsetSlider.setTextValueSuffix(" ms");
+    captureOffsetSlider.setDoubleClickReturnValue(true, ConsoleCapture::defaultOffsetMs);
+    captureOffsetSlider.setValue(p.getConsoleCapture().getOffsetMs(), juce::dontSendNotification);
+    captureOffsetSlider.onValueChange = [this]
+    {
+        audioProcessor.getConsoleCapture().setOffsetMs(captureOffsetSlider.getValue());
+    };
+    addAndMakeVisible(captureOffsetSlider);
+    
+    traceButton.setClickingTogglesState(true);
+    traceButton.setToggleState(PipelineTrace::isRecording(), juce::dontSendNotification);
+    traceButton.onClick = [this] { toggleTrace(); };
+    addAndMakeVisible(traceButton);
+    
+    statusLabel.setJustificationType(juce::Justification::topLeft);
+    statusLabel.setColour(juce::Label::textColourId, juce::Colours::orange);
+    addAndMakeVisible(statusLabel);
+    updateStatus();
+    
+    // Fixed window size (as per PLAN.md), widened if the strips need it
+    setSize (juce::jmax (920, 40 + ConsoleViewComponent::getPreferredWidth()), getBaseHeight());
 }
 
 CinemixBridgeEditor::~CinemixBridgeEditor()
@@ -51,10 +110,77 @@ void CinemixBridgeEditor::paint (juce::Graphics& g)
 
 void CinemixBridgeEditor::resized()
 {
-    auto bounds = getLocalBounds();
+    auto bounds = getLocalBounds().reduced(20, 10);
+    
+    if (monitor != nullptr)
+    {
+        monitor->setBounds(bounds.removeFromBottom(monitorHeight));
+        bounds.removeFromBottom(10);
+    }
+    
+    telemetryView.setBounds(bounds.removeFromBottom(TelemetryComponent::preferredHeight));
+    bounds.removeFromBottom(6);
+    
+    // Strips are 22px wide × 540px tall, from the top-left corner
+    consoleView.setBounds(bounds.removeFromLeft(ConsoleViewComponent::getPreferredWidth()));
+    
+    bounds.removeFromLeft(10);
+    monitorButton.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    hostMidiBusButton.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    telemetryLogButton.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    faderResolutionBox.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    timedCaptureButton.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    captureOffsetSlider.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    traceButton.setBounds(bounds.removeFromTop(24));
+    bounds.removeFromTop(6);
+    statusLabel.setBounds(bounds);
+}
+
+void CinemixBridgeEditor::toggleMonitor()
+{
+    // Closing the monitor stops the capture, so it costs nothing while hidden
+    if (monitorButton.getToggleState())
+    {
+        monitor = std::make_unique<MidiMonitorComponent>(audioProcessor.getMidiRouter().getTrafficCapture());
+        addAndMakeVisible(*monitor);
+        setSize(getWidth(), getBaseHeight() + monitorHeight + 10);
+    }
+    else
+    {
+        monitor = nullptr;
+        setSize(getWidth(), getBaseHeight());
+    }
+}
+
+void CinemixBridgeEditor::updateStatus()
+{
+    juce::StringArray lines;
+    lines.add(audioProcessor.getMappingError());
+    lines.add(audioProcessor.getRecoveryStatus());
+    lines.removeEmptyStrings();
+    
+    statusLabel.setText(lines.joinIntoString("\n"), juce::dontSendNotification);
+}
+
+void CinemixBridgeEditor::toggleTrace()
+{
+    if (traceButton.getToggleState())
+    {
+        PipelineTrace::start();
+        return;
+    }
+    
+    PipelineTrace::stop();
+    
+    auto file = PipelineTrace::getDefaultTraceFolder()
+                    .getChildFile("Trace_" + juce::Time::getCurrentTime().formatted("%Y%m%d_%H%M%S") + ".json");
     
-    // Position channel strip in top-left corner with some padding
-    // Channel strip is 22px wide × 540px tall
-    if (channelStrip)
-        channelStrip->setBounds(20, 10, 22, 540);
+    if (PipelineTrace::writeChromeTrace(file))
+        file.revealToUser();
 }
@@ -16,15 +16,18 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
-#include "ChannelStripComponent.h"
+#include "ConsoleViewComponent.h"
+#include "MidiMonitorComponent.h"
+#include "TelemetryComponent.h"
 
 //==============================================================================
 /**
  * CinemixBridgeEditor
  * 
  * Main GUI editor for the Cinemix Automation Bridge plugin.
- * Phase 5: Single channel strip UI for testing.
- * Full 36-channel UI will be implemented in Phase 6.
+ * Shows every channel strip through a single ConsoleViewComponent, with
+ * the bridge's activity LEDs and rates under it, and on request a MIDI
+ * monitor below (which only captures while open).
  */
 class CinemixBridgeEditor  : public juce::AudioProcessorEditor
 {
@@ -35,12 +38,50 @@ public:
     //==============================================================================
     void paint (juce::Graphics&) override;
     void resized() override;
+    
+    /** Shows the processor's mapping and recovery messages; called again when a session loads */
+    void updateStatus();
 
 private:
     CinemixBridgeProcessor& audioProcessor;
+    
+    static constexpr int consoleHeight = 560;
+    static constexpr int monitorHeight = 250;
 
-    // Phase 5: Single channel strip for testing
-    std::unique_ptr<ChannelStripComponent> channelStrip;
+    // All strips, drawn and refreshed as one component
+    ConsoleViewComponent consoleView;
+    
+    // Activity per strip and message rates, read from the router's counters
+    TelemetryComponent telemetryView;
+    
+    // MIDI traffic monitor: created when shown, deleted when hidden
+    juce::TextButton monitorButton { "MIDI Monitor" };
+    std::unique_ptr<MidiMonitorComponent> monitor;
+    
+    void toggleMonitor();
+    
+    // Console traffic through the host's MIDI routing instead of the devices
+    juce::ToggleButton hostMidiBusButton { "Host MIDI bus" };
+    
+    // Telemetry to a rolling CSV file
+    juce::ToggleButton telemetryLogButton { "Log telemetry" };
+    
+    // Effective fader resolution sent to the console (see MidiRouter::setFaderResolution)
+    juce::ComboBox faderResolutionBox;
+    
+    // Console moves written at their device time plus this offset (see ConsoleCapture)
+    juce::ToggleButton timedCaptureButton { "Timed capture" };
+    juce::Slider captureOffsetSlider;
+    
+    // Pipeline trace: written to a Chrome trace file when stopped
+    juce::TextButton traceButton { "Record Trace" };
+    
+    void toggleTrace();
+    
+    // What the user should know about: an ignored mapping file, a crash recovery
+    juce::Label statusLabel;
+    
+    int getBaseHeight() const noexcept { return consoleHeight + TelemetryComponent::preferredHeight + 6; }
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CinemixBridgeEditor)
 };
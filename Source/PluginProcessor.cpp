@@ -14,6 +14,7 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "PipelineTrace.h"
 
 //==============================================================================
 CinemixBridgeProcessor::CinemixBridgeProcessor()
@@ -29,77 +30,62 @@ CinemixBridgeProcessor::CinemixBridgeProcessor()
 #endif
       apvts(*this, nullptr, "Parameters", createParameterLayout())
 {
+    static_assert(SceneLibrary::numSceneValues == TotalParameters,
+                  "Scenes must hold exactly one value per parameter");
+    
     // Initialize animation phases
     animPhase.fill(0.0f);
     
-    // Add parameter listeners for all 161 parameters
-    for (int i = 0; i < 72; ++i)
-        apvts.addParameterListener("fader_" + juce::String(i), this);
-    
-    for (int i = 0; i < 72; ++i)
-        apvts.addParameterListener("mute_" + juce::String(i), this);
+    // Parameters are created in index order by createParameterLayout(), and
+    // listened to by index - no ID lookups when they change
+    auto& processorParameters = getParameters();
+    for (int i = 0; i < TotalParameters; ++i)
+    {
+        parameterPointers[i] = dynamic_cast<juce::RangedAudioParameter*>(processorParameters[i]);
+        parameterMirror.set(i, processorParameters[i]->getValue());
+        processorParameters[i]->addListener(this);
+    }
     
-    for (int i = 0; i < 10; ++i)
-        apvts.addParameterListener("aux_mute_" + juce::String(i), this);
+    // Open the shared scene library, if no other instance has (stays empty if the file is unusable)
+    if (!sceneLibrary->isOpen(SceneLibrary::getDefaultLibraryFile()))
+        sceneLibrary->open(SceneLibrary::getDefaultLibraryFile());
     
-    apvts.addParameterListener("joy1_x", this);
-    apvts.addParameterListener("joy1_y", this);
-    apvts.addParameterListener("joy1_mute", this);
-    apvts.addParameterListener("joy2_x", this);
-    apvts.addParameterListener("joy2_y", this);
-    apvts.addParameterListener("joy2_mute", this);
-    apvts.addParameterListener("master_fader", this);
+    // Apply the user's console remap, if there is one
+    // (a file that can't be used is ignored, and the editor says why)
+    auto mappingFile = MidiMappingTable::getDefaultMappingFile();
+    if (mappingFile.existsAsFile() && !midiRouter.loadMappingFile(mappingFile, mappingError))
+        mappingError = "Mapping file ignored: " + mappingError;
     
     // Setup callback from MidiRouter for incoming MIDI
-    midiRouter.onParameterChangeFromConsole = [this](int paramIndex, float value)
+    midiRouter.onParameterChangeFromConsole = [this](int paramIndex, float value, double timeMs)
     {
-        // Update parameter from console MIDI input
-        juce::String paramId;
-        if (paramIndex < 72)
-            paramId = "fader_" + juce::String(paramIndex);
-        else if (paramIndex < 144)
-            paramId = "mute_" + juce::String(paramIndex - 72);
-        else if (paramIndex < 154)
-            paramId = "aux_mute_" + juce::String(paramIndex - 144);
-        else if (paramIndex == 154)
-            paramId = "joy1_x";
-        else if (paramIndex == 155)
-            paramId = "joy1_y";
-        else if (paramIndex == 156)
-            paramId = "joy1_mute";
-        else if (paramIndex == 157)
-            paramId = "joy2_x";
-        else if (paramIndex == 158)
-            paramId = "joy2_y";
-        else if (paramIndex == 159)
-            paramId = "joy2_mute";
-        else if (paramIndex == 160)
-            paramId = "master_fader";
+        flightRecorder.record(paramIndex, value);
         
-        if (auto* param = apvts.getParameter(paramId))
-            param->setValueNotifyingHost(value);
+        // While the host plays, timed capture writes the move at its own time
+        if (!consoleCapture.add(paramIndex, value, timeMs))
+            notifyHostOfConsoleChange(paramIndex, value);
     };
+    
+    consoleCapture.onCapturedChange = [this](int paramIndex, float value) { notifyHostOfConsoleChange(paramIndex, value); };
+    
+    // File playback left the console at its own values: send the host's again
+    automationPlayer.onPlaybackStopped = [this] { snapshotPending = true; };
+    
+    // The console may have been power-cycled while its ports were gone
+    midiRouter.onConsoleNeedsResync = [this] { resyncPending = true; };
+    
+    // Parameter changes go out from processBlock; this covers stopped audio
+    startTimerHz(50);
 }
 
 CinemixBridgeProcessor::~CinemixBridgeProcessor()
 {
-    // Remove parameter listeners
-    for (int i = 0; i < 72; ++i)
-        apvts.removeParameterListener("fader_" + juce::String(i), this);
-    
-    for (int i = 0; i < 72; ++i)
-        apvts.removeParameterListener("mute_" + juce::String(i), this);
-    
-    for (int i = 0; i < 10; ++i)
-        apvts.removeParameterListener("aux_mute_" + juce::String(i), this);
+    stopTimer();
     
-    apvts.removeParameterListener("joy1_x", this);
-    apvts.removeParameterListener("joy1_y", this);
-    apvts.removeParameterListener("joy1_mute", this);
-    apvts.removeParameterListener("joy2_x", this);
-    apvts.removeParameterListener("joy2_y", this);
-    apvts.removeParameterListener("joy2_mute", this);
-    apvts.removeParameterListener("master_fader", this);
+    // Remove parameter listeners
+    auto& processorParameters = getParameters();
+    for (int i = 0; i < TotalParameters; ++i)
+        processorParameters[i]->removeListener(this);
 }
 
 //==============================================================================
@@ -142,38 +128,43 @@ double CinemixBridgeProcessor::getTailLengthSeconds() const
 
 int CinemixBridgeProcessor::getNumPrograms()
 {
-    return 1;
+    // Hosts expect at least one program, even with an empty scene library
+    return juce::jmax(1, sceneLibrary->getNumScenes());
 }
 
 int CinemixBridgeProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentScene;
 }
 
 void CinemixBridgeProcessor::setCurrentProgram (int index)
 {
-    juce::ignoreUnused(index);
+    recallScene(index);
 }
 
 const juce::String CinemixBridgeProcessor::getProgramName (int index)
 {
-    juce::ignoreUnused(index);
-    return {};
+    return sceneLibrary->getSceneName(index);
 }
 
 void CinemixBridgeProcessor::changeProgramName (int index, const juce::String& newName)
 {
-    juce::ignoreUnused(index, newName);
+    sceneLibrary->setSceneName(index, newName);
 }
 
 //==============================================================================
 void CinemixBridgeProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    juce::ignoreUnused(samplesPerBlock);
-    
     // Calculate animation rates for test mode
     faderAnimRate = static_cast<int>(sampleRate / 25.0);  // 25 Hz
     muteAnimRate = static_cast<int>(sampleRate / 10.0);   // 10 Hz
+    
+    morphEngine.prepare(sampleRate);
+    automationPlayer.prepare(sampleRate, samplesPerBlock);
+    consoleCapture.prepare(sampleRate);
+    midiRouter.getHostMidiBus().prepare(sampleRate);
+    
+    openJournal();
 }
 
 void CinemixBridgeProcessor::releaseResources()
@@ -204,6 +195,8 @@ bool CinemixBridgeProcessor::isBusesLayoutSupported (const BusesLayout& layouts)
 
 void CinemixBridgeProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
+    CINEMIX_RT_AUDIT_SCOPE("CinemixBridgeProcessor::processBlock");
+    
     juce::ScopedNoDenormals noDenormals;
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -211,6 +204,20 @@ void CinemixBridgeProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
     // Clear any output channels that didn't have input
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
+    
+    // In host MIDI bus mode, console moves arrive on our MIDI input
+    bool usingHostMidiBus = midiRouter.isUsingHostMidiBus();
+    
+    if (usingHostMidiBus)
+        midiRouter.getHostMidiBus().receiveBlock(midiMessages);
+    
+    // The timer may still be finishing a send from while audio was stopped;
+    // if so, this block leaves the console alone
+    bool ownsSending = beginSending(Sender::audio);
+    
+    // Console moves whose place on the timeline falls in this block
+    if (ownsSending)
+        consoleCapture.processBlock(getPlayHead(), buffer.getNumSamples());
 
     // Test mode animation (if enabled)
     if (testModeEnabled)
@@ -228,11 +235,28 @@ void CinemixBridgeProcessor::processBlock (juce::AudioBuffer<float>& buffer, juc
         }
     }
     
-    // For now, we're just passing audio through (or outputting silence)
-    // MIDI handling will be added in Phase 3
+    // Scene morph - a new interpolated mix at the morph control rate
+    if (morphEngine.process(buffer.getNumSamples(), morphOutput))
+        applyParameterValues(morphOutput);
     
-    // Clear MIDI output for now
+    // Automation file playback, locked to the host playhead
+    automationPlayer.processBlock(getPlayHead(), buffer.getNumSamples());
+    
+    // Everything automated since the last block, once per parameter
+    if (ownsSending)
+    {
+        sendChangedParameters();
+        endSending();
+    }
+    
+    lastBlockTimeMs = juce::Time::getMillisecondCounter();
+    
+    // Audio passes through; the MIDI output carries console traffic, if
+    // anything (host MIDI bus mode), and nothing of the host's input
     midiMessages.clear();
+    
+    if (usingHostMidiBus)
+        midiRouter.getHostMidiBus().renderBlock(midiMessages, buffer.getNumSamples());
 }
 
 //==============================================================================
@@ -251,6 +275,18 @@ void CinemixBridgeProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
     // Save parameter state
     auto state = apvts.copyState();
+    
+    // Console channels this instance drives when several share the console
+    state.setProperty("ownedFirstChannel", midiRouter.getFirstOwnedChannel(), nullptr);
+    state.setProperty("ownedLastChannel", midiRouter.getLastOwnedChannel(), nullptr);
+    state.setProperty("ownsMasterSection", midiRouter.ownsMasterSection(), nullptr);
+    state.setProperty("hostMidiBus", midiRouter.isUsingHostMidiBus(), nullptr);
+    state.setProperty("telemetryLog", telemetryLogger.isLogging(), nullptr);
+    state.setProperty("faderResolution", midiRouter.getFaderResolution(), nullptr);
+    state.setProperty("journalId", stateJournal.getJournalId(), nullptr);
+    state.setProperty("timedCapture", consoleCapture.isEnabled(), nullptr);
+    state.setProperty("captureOffsetMs", consoleCapture.getOffsetMs(), nullptr);
+    
     std::unique_ptr<juce::XmlElement> xml (state.createXml());
     copyXmlToBinary (*xml, destData);
 }
@@ -261,8 +297,33 @@ void CinemixBridgeProcessor::setStateInformation (const void* data, int sizeInBy
     std::unique_ptr<juce::XmlElement> xmlState (getXmlFromBinary (data, sizeInBytes));
 
     if (xmlState.get() != nullptr)
+    {
         if (xmlState->hasTagName (apvts.state.getType()))
-            apvts.replaceState (juce::ValueTree::fromXml (*xmlState));
+        {
+            auto state = juce::ValueTree::fromXml (*xmlState);
+            
+            // Sessions saved before channel ownership existed drive the whole console
+            midiRouter.setOwnedChannels ((int) state.getProperty ("ownedFirstChannel", 0),
+                                         (int) state.getProperty ("ownedLastChannel", CinemixConsole::numChannels - 1),
+                                         (bool) state.getProperty ("ownsMasterSection", true));
+            
+            setUsingHostMidiBus ((bool) state.getProperty ("hostMidiBus", false));
+            setTelemetryLogging ((bool) state.getProperty ("telemetryLog", false));
+            midiRouter.setFaderResolution ((int) state.getProperty ("faderResolution", CinemixCodec::fullFaderResolution));
+            consoleCapture.setEnabled ((bool) state.getProperty ("timedCapture", false));
+            consoleCapture.setOffsetMs ((double) state.getProperty ("captureOffsetMs", ConsoleCapture::defaultOffsetMs));
+            
+            auto request = resumeJournal (state);
+            apvts.replaceState (state);
+            
+            // Resumed or activated with the recovered values in place
+            if (request != ConsoleRequest::none)
+                requestConsole (request);
+            
+            if (auto* editor = dynamic_cast<CinemixBridgeEditor*> (getActiveEditor()))
+                editor->updateStatus();
+        }
+    }
 }
 
 //==============================================================================
@@ -271,123 +332,95 @@ void CinemixBridgeProcessor::setStateInformation (const void* data, int sizeInBy
 
 juce::AudioProcessorValueTreeState::ParameterLayout CinemixBridgeProcessor::createParameterLayout()
 {
-    std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
-    
-    // Faders: 0-71 (72 total)
-    for (int i = 0; i < 72; ++i)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>(
-            "fader_" + juce::String(i),
-            getFaderParameterName(i),
-            0.0f, 1.0f, 0.754f));  // Default at 0.754 (unity gain position)
-    }
+    juce::AudioProcessorValueTreeState::ParameterLayout layout;
     
-    // Mutes: 72-143 (72 total)
-    for (int i = 0; i < 72; ++i)
+    // IDs, names, groups and order all come from the console layout (the
+    // text is generated at compile time). Groups cover consecutive indices,
+    // so parameters stay in index order.
+    for (const auto& group : CinemixConsole::parameterGroups)
     {
-        params.push_back(std::make_unique<juce::AudioParameterBool>(
-            "mute_" + juce::String(i),
-            getMuteParameterName(i),
-            false));
-    }
-    
-    // AUX Mutes: 144-153 (10 total)
-    for (int i = 0; i < 10; ++i)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterBool>(
-            "aux_mute_" + juce::String(i),
-            "AUX " + juce::String(i + 1) + " Mute",
-            false));
+        auto parameterGroup = std::make_unique<juce::AudioProcessorParameterGroup>(group.id, group.name, "|");
+        
+        for (int i = group.firstIndex; i <= group.lastIndex; ++i)
+        {
+            const auto& text = CinemixConsole::parameterTexts[(size_t) i];
+            juce::ParameterID id { text.id };
+            
+            switch (CinemixConsole::mappings[(size_t) i].kind)
+            {
+                case CinemixConsole::Kind::fader:
+                    // Channel faders default to unity gain (0.754), the master to max
+                    parameterGroup->addChild(std::make_unique<juce::AudioParameterFloat>(
+                        id, text.name, 0.0f, 1.0f, i == MasterFader ? 1.0f : 0.754f));
+                    break;
+                
+                case CinemixConsole::Kind::joystickAxis:
+                    parameterGroup->addChild(std::make_unique<juce::AudioParameterFloat>(
+                        id, text.name, 0.0f, 1.0f, 0.5f));
+                    break;
+                
+                case CinemixConsole::Kind::mute:
+                case CinemixConsole::Kind::auxMute:
+                case CinemixConsole::Kind::joystickMute:
+                    parameterGroup->addChild(std::make_unique<juce::AudioParameterBool>(id, text.name, false));
+                    break;
+            }
+        }
+        
+        layout.add(std::move(parameterGroup));
     }
     
-    // Master Section: 154-160
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "joy1_x", "Joystick 1 X", 0.0f, 1.0f, 0.5f));
-    
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "joy1_y", "Joystick 1 Y", 0.0f, 1.0f, 0.5f));
-    
-    params.push_back(std::make_unique<juce::AudioParameterBool>(
-        "joy1_mute", "Joystick 1 Mute", false));
-    
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "joy2_x", "Joystick 2 X", 0.0f, 1.0f, 0.5f));
-    
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "joy2_y", "Joystick 2 Y", 0.0f, 1.0f, 0.5f));
-    
-    params.push_back(std::make_unique<juce::AudioParameterBool>(
-        "joy2_mute", "Joystick 2 Mute", false));
-    
-    params.push_back(std::make_unique<juce::AudioParameterFloat>(
-        "master_fader", "Master Fader", 0.0f, 1.0f, 1.0f));  // Default at max
-    
-    return { params.begin(), params.end() };
+    return layout;
 }
 
-juce::String CinemixBridgeProcessor::getFaderParameterName(int index)
+//==============================================================================
+// Console Control Methods (Stubs for Phase 1)
+//==============================================================================
+
+void CinemixBridgeProcessor::activateConsole()
 {
-    // Determine which channel (0-35) and which row (upper/lower)
-    int channel = index / 2;
-    bool isUpper = (index % 2 == 0);
-    
-    juce::String channelName;
-    
-    // Channels 24-27 are stereo channels (S1-S4)
-    if (channel >= 24 && channel < 28)
-    {
-        channelName = "S" + juce::String(channel - 23);
-    }
-    else
-    {
-        // Mono channels - adjust numbering
-        int monoNum = (channel < 24) ? (channel + 1) : (channel - 3);
-        channelName = "M" + juce::String(monoNum);
-    }
-    
-    return "Fader " + juce::String(isUpper ? "Upper " : "Lower ") + channelName;
+    // Initialisation sequence, then a snapshot of all parameters
+    requestConsole(ConsoleRequest::activate);
+    checkpointJournal();
 }
 
-juce::String CinemixBridgeProcessor::getMuteParameterName(int index)
+void CinemixBridgeProcessor::deactivateConsole()
 {
-    // Same logic as fader names
-    int channel = index / 2;
-    bool isUpper = (index % 2 == 0);
-    
-    juce::String channelName;
+    requestConsole(ConsoleRequest::deactivate);
+    checkpointJournal();
+}
+
+void CinemixBridgeProcessor::requestConsole(ConsoleRequest request)
+{
+    // Request first: a sender that sees the new state also sees the request
+    consoleRequest = request;
+    consoleActive = request != ConsoleRequest::deactivate;
     
-    if (channel >= 24 && channel < 28)
-    {
-        channelName = "S" + juce::String(channel - 23);
-    }
+    // Console moves are recorded while the console is in use, one file per activation
+    if (consoleActive)
+        flightRecorder.start();
     else
-    {
-        int monoNum = (channel < 24) ? (channel + 1) : (channel - 3);
-        channelName = "M" + juce::String(monoNum);
-    }
-    
-    return "Mute " + juce::String(isUpper ? "Upper " : "Lower ") + channelName;
+        flightRecorder.stop();
 }
 
-//==============================================================================
-// Console Control Methods (Stubs for Phase 1)
-//==============================================================================
-
-void CinemixBridgeProcessor::activateConsole()
+void CinemixBridgeProcessor::setUsingHostMidiBus(bool shouldUseHostBus)
 {
-    consoleActive = true;
+    if (shouldUseHostBus == midiRouter.isUsingHostMidiBus())
+        return;
     
-    // Send full initialization sequence
-    midiRouter.sendInitializationSequence();
+    midiRouter.setUsingHostMidiBus(shouldUseHostBus);
     
-    // Send current snapshot of all parameters
-    sendSnapshot();
+    // The console on the new route needs the handshake and the whole mix
+    if (consoleActive)
+        activateConsole();
 }
 
-void CinemixBridgeProcessor::deactivateConsole()
+void CinemixBridgeProcessor::setTelemetryLogging(bool shouldLog)
 {
-    consoleActive = false;
-    midiRouter.sendDeactivateCommand();
+    if (shouldLog)
+        telemetryLogger.start();
+    else
+        telemetryLogger.stop();
 }
 
 void CinemixBridgeProcessor::resetAll()
@@ -453,41 +486,8 @@ void CinemixBridgeProcessor::toggleAllMutes()
 
 void CinemixBridgeProcessor::sendSnapshot()
 {
-    // Collect all current parameter values
-    std::array<float, 161> paramValues;
-    
-    for (int i = 0; i < 161; ++i)
-    {
-        juce::String paramId;
-        if (i < 72)
-            paramId = "fader_" + juce::String(i);
-        else if (i < 144)
-            paramId = "mute_" + juce::String(i - 72);
-        else if (i < 154)
-            paramId = "aux_mute_" + juce::String(i - 144);
-        else if (i == 154)
-            paramId = "joy1_x";
-        else if (i == 155)
-            paramId = "joy1_y";
-        else if (i == 156)
-            paramId = "joy1_mute";
-        else if (i == 157)
-            paramId = "joy2_x";
-        else if (i == 158)
-            paramId = "joy2_y";
-        else if (i == 159)
-            paramId = "joy2_mute";
-        else if (i == 160)
-            paramId = "master_fader";
-        
-        if (auto* param = apvts.getRawParameterValue(paramId))
-            paramValues[i] = param->load();
-        else
-            paramValues[i] = 0.0f;
-    }
-    
-    // Send snapshot to console
-    midiRouter.sendFullSnapshot(paramValues);
+    // Every parameter goes out with the next send
+    snapshotPending = true;
 }
 
 void CinemixBridgeProcessor::setTestMode(bool enable)
@@ -498,8 +498,8 @@ void CinemixBridgeProcessor::setTestMode(bool enable)
     {
         // Initialize animation phases with offset
         float phaseOffset = -2.0f;
-        float phaseIncrement = 4.0f / 72.0f;
-        for (int i = 0; i < 72; ++i)
+        float phaseIncrement = 4.0f / (float) CinemixConsole::numFaders;
+        for (int i = 0; i < CinemixConsole::numFaders; ++i)
         {
             animPhase[i] = phaseOffset + (phaseIncrement * i);
         }
@@ -510,7 +510,7 @@ void CinemixBridgeProcessor::setTestMode(bool enable)
 void CinemixBridgeProcessor::animateFaders()
 {
     // Animate faders with sine wave pattern
-    for (int i = 0; i < 72; ++i)
+    for (int i = 0; i < CinemixConsole::numFaders; ++i)
     {
         animPhase[i] += 0.05f;
         if (animPhase[i] > 1.0f)
@@ -520,21 +520,36 @@ void CinemixBridgeProcessor::animateFaders()
         float ramp = animPhase[i];
         float value = (ramp * (1.0f - std::abs(ramp)) * 2.0f) + 0.5f;
         
-        if (auto* param = apvts.getParameter("fader_" + juce::String(i)))
+        if (auto* param = parameterPointers[FaderStart + i])
+        {
+            CINEMIX_RT_AUDIT_ALLOW("host notification");
             param->setValueNotifyingHost(value);
+        }
     }
 }
 
 void CinemixBridgeProcessor::animateMutes()
 {
     // Randomize mutes
-    juce::Random random;
-    
-    for (int i = 0; i < 72; ++i)
+    for (int i = 0; i < CinemixConsole::numMutes; ++i)
     {
-        bool muteState = random.nextFloat() > 0.5f;
-        if (auto* param = apvts.getParameter("mute_" + juce::String(i)))
+        bool muteState = animRandom.nextFloat() > 0.5f;
+        if (auto* param = parameterPointers[MuteStart + i])
+        {
+            CINEMIX_RT_AUDIT_ALLOW("host notification");
             param->setValueNotifyingHost(muteState ? 1.0f : 0.0f);
+        }
+    }
+}
+
+void CinemixBridgeProcessor::notifyHostOfConsoleChange(int paramIndex, float value)
+{
+    // Update parameter from console MIDI input
+    if (paramIndex >= 0 && paramIndex < TotalParameters && parameterPointers[paramIndex] != nullptr)
+    {
+        CINEMIX_RT_AUDIT_ALLOW("host notification");
+        const PipelineTrace::Span traceSpan(PipelineTrace::Stage::hostNotify, paramIndex, (juce::int32) (value * 16383.0f));
+        parameterPointers[paramIndex]->setValueNotifyingHost(value);
     }
 }
 
@@ -547,55 +562,271 @@ void CinemixBridgeProcessor::syncParameterToMidi(int paramIndex, float value)
     }
 }
 
-//==============================================================================
-// Parameter Change Listener Implementation
+void CinemixBridgeProcessor::sendChangedParameters()
+{
+    ParameterMirror::Mask changes;
+    
+    // Taken even while inactive: activation sends a full snapshot anyway
+    bool hasChanges = parameterMirror.takeChanges(ParameterMirror::midiOutput, changes);
+    bool needsSnapshot = snapshotPending.exchange(false);
+    bool needsResync = resyncPending.exchange(false);
+    
+    // Read before the request (see requestConsole); a request overrides it
+    bool active = consoleActive.load();
+    auto request = consoleRequest.exchange(ConsoleRequest::none);
+    
+    switch (request)
+    {
+        case ConsoleRequest::none:
+            break;
+        
+        case ConsoleRequest::deactivate:
+            midiRouter.sendDeactivateCommand();
+            active = false;
+            break;
+        
+        case ConsoleRequest::activate:
+            // Handshake (skipped if the console is already live), then the whole mix
+            midiRouter.sendInitializationSequence();
+            needsSnapshot = true;
+            active = true;
+            break;
+        
+        case ConsoleRequest::resume:
+            active = true;
+            break;
+    }
+    
+    if (!active)
+        return;
+    
+    // A long port outage: the handshake again (the console is no longer
+    // live), then every owned parameter
+    if (needsResync && request != ConsoleRequest::activate)
+    {
+        midiRouter.sendInitializationSequence();
+        needsSnapshot = true;
+    }
+    
+    // What a short port outage dropped
+    midiRouter.sendPendingReconnectMessages();
+    
+    if (!(hasChanges || needsSnapshot || request == ConsoleRequest::resume))
+        return;
+    
+    // Encoded and compared as one batch, however many changed
+    std::array<float, TotalParameters> values;
+    parameterMirror.getValues(values);
+    
+    // Warm resume: the console still shows the recovered values, which the
+    // loaded state put in the mirror, so only later changes go out
+    if (request == ConsoleRequest::resume)
+        midiRouter.restoreConsoleState(values);
+    
+    if (needsSnapshot)
+        midiRouter.sendFullSnapshot(values);
+    else
+        midiRouter.sendParameterValues(values, changes);
+}
+
+bool CinemixBridgeProcessor::beginSending(Sender thread) noexcept
+{
+    auto expected = Sender::none;
+    return sender.compare_exchange_strong(expected, thread);
+}
 
-void CinemixBridgeProcessor::parameterChanged(const juce::String& parameterID, float newValue)
+void CinemixBridgeProcessor::timerCallback()
 {
-    // Convert parameter ID to index and sync to MIDI
-    int paramIndex = getParameterIndex(parameterID);
-    if (paramIndex >= 0)
+    // Console fader moves whose LSB never arrived
+    midiRouter.passOnUnpairedFaderMsbs();
+    
+    // Hosts may stop calling processBlock (transport stopped, audio off);
+    // UI and host edits must still reach the console
+    if (juce::Time::getMillisecondCounter() - lastBlockTimeMs.load() > 100
+        && beginSending(Sender::timer))
     {
-        syncParameterToMidi(paramIndex, newValue);
+        consoleCapture.flush();
+        sendChangedParameters();
+        endSending();
     }
+    
+    if (stateJournal.needsCheckpoint())
+        checkpointJournal();
 }
 
-int CinemixBridgeProcessor::getParameterIndex(const juce::String& parameterID) const
+//==============================================================================
+// Crash Recovery
+
+void CinemixBridgeProcessor::openJournal()
 {
-    // Faders: "fader_0" to "fader_71"
-    if (parameterID.startsWith("fader_"))
+    // A fresh ID, unless a loaded session's journal is already open
+    if (stateJournal.isOpen())
+        return;
+    
+    StateJournal::Values values;
+    parameterMirror.getValues(values);
+    stateJournal.open(juce::Uuid().toString(), values, consoleActive);
+}
+
+void CinemixBridgeProcessor::checkpointJournal()
+{
+    StateJournal::Values values;
+    parameterMirror.getValues(values);
+    stateJournal.checkpoint(values, consoleActive);
+}
+
+CinemixBridgeProcessor::ConsoleRequest CinemixBridgeProcessor::resumeJournal(juce::ValueTree& state)
+{
+    auto savedId = state.getProperty("journalId").toString();
+    
+    if (savedId.isEmpty() || savedId == stateJournal.getJournalId())
+        return ConsoleRequest::none;
+    
+    // A different session: the last one's recovery no longer applies
+    recoveryStatus.clear();
+    
+    StateJournal::Values values;
+    StateJournal::RecoveredState recovered;
+    parameterMirror.getValues(values);
+    
+    // Fails if another instance already has that journal (a duplicated
+    // track, or the same session loaded twice): this one keeps its own
+    if (!stateJournal.open(savedId, values, consoleActive, &recovered) || !recovered.isValid)
+        return ConsoleRequest::none;
+    
+    // The saved value stays where the journal agrees to its precision, so a
+    // session that didn't change since it was saved loads exactly as saved
+    for (int i = 0; i < TotalParameters; ++i)
     {
-        int index = parameterID.substring(6).getIntValue();
-        if (index >= 0 && index < 72)
-            return index;
+        auto* param = parameterPointers[i];
+        auto child = state.getChildWithProperty("id", CinemixConsole::getParameterID(i));
+        
+        if (param == nullptr || !child.isValid())
+            continue;
+        
+        auto defaultValue = param->convertFrom0to1(param->getDefaultValue());
+        auto savedValue = param->convertTo0to1((float) (double) child.getProperty("value", defaultValue));
+        
+        if (std::abs(savedValue - recovered.values[(size_t) i]) <= 1.0f / 65535.0f)
+            recovered.values[(size_t) i] = savedValue;
+        else
+            child.setProperty("value", param->convertFrom0to1(recovered.values[(size_t) i]), nullptr);
     }
     
-    // Mutes: "mute_0" to "mute_71"
-    if (parameterID.startsWith("mute_"))
+    // Shown in the editor, with how the console was picked up again
+    recoveryStatus = "Recovered " + juce::String(recovered.numChangesReplayed) + " changes after a crash";
+    
+    if (recovered.numChangesLost > 0)
+        recoveryStatus << " (" << recovered.numChangesLost << " lost)";
+    
+    if (!recovered.consoleActive || consoleActive)
+        return ConsoleRequest::none;
+    
+    // Warm resume: the console still shows what it was last sent, so the
+    // handshake is skipped and only later changes go out. Only trusted if the
+    // session was running moments ago and the ports don't say otherwise
+    auto sinceCheckpointMs = juce::Time::currentTimeMillis() - recovered.checkpointTimeMs;
+    
+    if (juce::isPositiveAndBelow(sinceCheckpointMs, (juce::int64) warmResumeWindowMs)
+        && !midiRouter.isConsoleKnownDown())
     {
-        int index = parameterID.substring(5).getIntValue();
-        if (index >= 0 && index < 72)
-            return 72 + index;
+        recoveryStatus << "; console resumed as it was";
+        return ConsoleRequest::resume;
     }
     
-    // AUX Mutes: "aux_mute_0" to "aux_mute_9"
-    if (parameterID.startsWith("aux_mute_"))
+    // The console may have been power-cycled since: activate it as usual
+    recoveryStatus << "; console reinitialised";
+    return ConsoleRequest::activate;
+}
+
+//==============================================================================
+// Scenes
+
+int CinemixBridgeProcessor::storeScene(const juce::String& name)
+{
+    SceneLibrary::SceneValues values;
+    getCurrentParameterValues(values);
+    
+    int index = sceneLibrary->addScene(name, values);
+    if (index >= 0)
     {
-        int index = parameterID.substring(9).getIntValue();
-        if (index >= 0 && index < 10)
-            return 144 + index;
+        currentScene = index;
+        updateHostDisplay(ChangeDetails().withProgramChanged(true));
     }
     
-    // Master section
-    if (parameterID == "joy1_x") return 154;
-    if (parameterID == "joy1_y") return 155;
-    if (parameterID == "joy1_mute") return 156;
-    if (parameterID == "joy2_x") return 157;
-    if (parameterID == "joy2_y") return 158;
-    if (parameterID == "joy2_mute") return 159;
-    if (parameterID == "master_fader") return 160;
+    return index;
+}
+
+void CinemixBridgeProcessor::recallScene(int sceneIndex)
+{
+    SceneLibrary::SceneValues values;
+    if (!sceneLibrary->getSceneValues(sceneIndex, values))
+        return;
+    
+    // A recall replaces any morph in progress
+    morphEngine.stop();
+    currentScene = sceneIndex;
+    applyParameterValues(values);
+}
+
+void CinemixBridgeProcessor::morphToScene(int sceneIndex, double durationSeconds)
+{
+    SceneLibrary::SceneValues fromValues, toValues;
+    if (!sceneLibrary->getSceneValues(sceneIndex, toValues))
+        return;
+    
+    getCurrentParameterValues(fromValues);
+    currentScene = sceneIndex;
+    morphEngine.start(fromValues, toValues, durationSeconds);
+}
+
+void CinemixBridgeProcessor::getCurrentParameterValues(SceneLibrary::SceneValues& values) const
+{
+    // All parameters are 0-1 (floats) or bools, so normalised == actual value
+    parameterMirror.getValues(values);
+}
+
+void CinemixBridgeProcessor::applyParameterValues(const SceneLibrary::SceneValues& values)
+{
+    // Delta recall: only parameters that actually differ reach the host and the console
+    for (int i = 0; i < TotalParameters; ++i)
+    {
+        auto* param = parameterPointers[i];
+        if (param == nullptr)
+            continue;
+        
+        // Switches (bool parameters) take a morph's in-between values as off
+        // or on, so they change once, at the midpoint, not on every tick
+        auto value = values[i];
+        auto kind = CinemixConsole::mappings[(size_t) i].kind;
+        
+        if (kind != CinemixConsole::Kind::fader && kind != CinemixConsole::Kind::joystickAxis)
+            value = value >= 0.5f ? 1.0f : 0.0f;
+        
+        if (parameterMirror.get(i) != value)
+        {
+            CINEMIX_RT_AUDIT_ALLOW("host notification");
+            param->setValueNotifyingHost(value);
+        }
+    }
+}
+
+//==============================================================================
+// Parameter Change Listener Implementation
+
+void CinemixBridgeProcessor::parameterValueChanged(int parameterIndex, float newValue)
+{
+    CINEMIX_RT_AUDIT_SCOPE("CinemixBridgeProcessor::parameterValueChanged");
     
-    return -1;  // Invalid parameter ID
+    // Every parameter is 0-1, so the normalised value is the value. Only
+    // recorded here: consumers pick up the change when they next look
+    parameterMirror.set(parameterIndex, newValue);
+    stateJournal.append(parameterIndex, newValue);
+    PipelineTrace::instant(PipelineTrace::Stage::hostChange, parameterIndex, (juce::int32) (newValue * 16383.0f));
+}
+
+void CinemixBridgeProcessor::parameterGestureChanged(int, bool)
+{
 }
 
 //==============================================================================
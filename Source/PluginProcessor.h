@@ -15,18 +15,30 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "ConsoleLayout.h"
 #include "MidiRouter.h"
+#include "SceneLibrary.h"
+#include "SceneMorphEngine.h"
+#include "FlightRecorder.h"
+#include "AutomationPlayer.h"
+#include "ParameterMirror.h"
+#include "RealtimeAudit.h"
+#include "TelemetryLogger.h"
+#include "StateJournal.h"
+#include "ConsoleCapture.h"
 
 //==============================================================================
 /**
  * CinemixBridgeProcessor
  * 
  * Main audio processor for the Cinemix Automation Bridge plugin.
- * Manages 161 parameters and handles bidirectional MIDI communication
- * with the D&R Cinemix console.
+ * Manages one parameter per fader, mute and master control of the frame
+ * described by CinemixConsole (161 on a 36-channel console) and handles
+ * bidirectional MIDI communication with the D&R Cinemix console.
  */
 class CinemixBridgeProcessor : public juce::AudioProcessor,
-                                private juce::AudioProcessorValueTreeState::Listener
+                                private juce::AudioProcessorParameter::Listener,
+                                private juce::Timer
 {
 public:
     //==============================================================================
@@ -67,7 +79,8 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
 
     //==============================================================================
-    // Console control methods
+    // Console control methods. These only ask: the thread sending to the
+    // console (audio, or the timer while audio is stopped) does the sending
     void activateConsole();
     void deactivateConsole();
     void resetAll();
@@ -75,42 +88,80 @@ public:
     void sendSnapshot();
     void setTestMode(bool enable);
     
+    /** Routes console traffic through the plugin's MIDI bus (see HostMidiTransport) */
+    void setUsingHostMidiBus(bool shouldUseHostBus);
+    
+    /** Writes the router's telemetry to a rolling CSV file (see TelemetryLogger) */
+    void setTelemetryLogging(bool shouldLog);
+    bool isTelemetryLogging() const { return telemetryLogger.isLogging(); }
+    
     //==============================================================================
     // Parameter access
     juce::AudioProcessorValueTreeState& getAPVTS() { return apvts; }
     
+    // Every parameter value plus what changed, per consumer (see ParameterMirror)
+    ParameterMirror& getParameterMirror() { return parameterMirror; }
+    
     // MIDI Router access
     MidiRouter& getMidiRouter() { return midiRouter; }
     
+    // Why the user's mapping file wasn't applied (empty if it was, or there is none)
+    const juce::String& getMappingError() const { return mappingError; }
+    
+    // What a loaded session got back from its crash journal (empty if nothing)
+    const juce::String& getRecoveryStatus() const { return recoveryStatus; }
+    
+    // Console move recorder (see FlightRecording for reading sessions back)
+    FlightRecorder& getFlightRecorder() { return flightRecorder; }
+    
+    // Plays MIDI files / recorded sessions to the console against the host playhead
+    AutomationPlayer& getAutomationPlayer() { return automationPlayer; }
+    
+    // Writes console moves to the host at their device time plus a set offset
+    ConsoleCapture& getConsoleCapture() { return consoleCapture; }
+    
     // Helper to send parameter changes to console
     void syncParameterToMidi(int paramIndex, float value);
     
     //==============================================================================
-    // Parameter indices (for reference)
+    // Scenes (also exposed to the host as programs)
+    SceneLibrary& getSceneLibrary() { return *sceneLibrary; }
+    
+    /** Stores the current mix as a new scene and returns its index */
+    int storeScene(const juce::String& name);
+    
+    /** Recalls a scene, changing only the parameters that differ */
+    void recallScene(int sceneIndex);
+    
+    /** Morphs from the current mix to a scene over the given time */
+    void morphToScene(int sceneIndex, double durationSeconds);
+    
+    //==============================================================================
+    // Parameter indices - generated from the console layout (values shown for 36 channels)
     enum ParameterIndices
     {
-        // Faders: 0-71 (36 channels × 2 rows)
-        FaderStart = 0,
-        FaderEnd = 71,
+        // Faders: 0-71 (upper row, then lower row)
+        FaderStart = CinemixConsole::faderStart,
+        FaderEnd = CinemixConsole::faderEnd,
         
-        // Mutes: 72-143 (36 channels × 2 rows)
-        MuteStart = 72,
-        MuteEnd = 143,
+        // Mutes: 72-143 (upper row, then lower row)
+        MuteStart = CinemixConsole::muteStart,
+        MuteEnd = CinemixConsole::muteEnd,
         
         // AUX Mutes: 144-153
-        AuxMuteStart = 144,
-        AuxMuteEnd = 153,
+        AuxMuteStart = CinemixConsole::auxMuteStart,
+        AuxMuteEnd = CinemixConsole::auxMuteEnd,
         
         // Master Section: 154-160
-        Joy1_X = 154,
-        Joy1_Y = 155,
-        Joy1_Mute = 156,
-        Joy2_X = 157,
-        Joy2_Y = 158,
-        Joy2_Mute = 159,
-        MasterFader = 160,
+        Joy1_X = CinemixConsole::joy1X,
+        Joy1_Y = CinemixConsole::joy1Y,
+        Joy1_Mute = CinemixConsole::joy1Mute,
+        Joy2_X = CinemixConsole::joy2X,
+        Joy2_Y = CinemixConsole::joy2Y,
+        Joy2_Mute = CinemixConsole::joy2Mute,
+        MasterFader = CinemixConsole::masterFader,
         
-        TotalParameters = 161
+        TotalParameters = CinemixConsole::totalParameters
     };
 
 private:
@@ -121,20 +172,97 @@ private:
     
     // MIDI Router
     MidiRouter midiRouter;
+    juce::String mappingError;
+    
+    // Records every decoded console event to disk
+    FlightRecorder flightRecorder;
+    
+    // Optional CSV log of the router's counters
+    TelemetryLogger telemetryLogger { [this](BridgeTelemetry::Snapshot& snapshot) { midiRouter.getTelemetrySnapshot(snapshot); } };
+    
+    // Streams automation files to the console
+    AutomationPlayer automationPlayer { midiRouter };
+    
+    // Holds console moves until their place on the host timeline
+    ConsoleCapture consoleCapture;
+    
+    /** Passes a console move on to the host as a parameter change */
+    void notifyHostOfConsoleChange(int paramIndex, float value);
     
-    // Helper methods for parameter creation
-    juce::String getFaderParameterName(int index);
-    juce::String getMuteParameterName(int index);
+    // Parameters in index order, resolved once at construction
+    std::array<juce::RangedAudioParameter*, TotalParameters> parameterPointers;
     
-    // Helper to convert parameter ID to index
-    int getParameterIndex(const juce::String& parameterID) const;
+    // Written by the parameter listener; read by the MIDI sender and the editor
+    ParameterMirror parameterMirror;
     
-    // AudioProcessorValueTreeState::Listener implementation
-    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    // Every change since the session was last saved, for recovery after a crash.
+    // Opened on first use, so instances that never play (plugin scans) leave no file
+    StateJournal stateJournal;
+    juce::String recoveryStatus;
+    
+    // Set when the console no longer shows the host's values (automation playback stopped)
+    std::atomic<bool> snapshotPending { false };
+    
+    // Set by a port watcher when the console may have been power-cycled: it
+    // needs the handshake and the whole mix again
+    std::atomic<bool> resyncPending { false };
+    
+    // When processBlock last ran, so the timer only sends while audio is stopped
+    std::atomic<juce::uint32> lastBlockTimeMs { 0 };
+    
+    // The thread sending to the console and delivering captured moves. Taken
+    // with a compare-exchange, so the audio thread and the timer never both
+    // consume the mirror's changes (or touch the router's sent values)
+    enum class Sender { none, audio, timer };
+    std::atomic<Sender> sender { Sender::none };
+    
+    bool beginSending(Sender thread) noexcept;
+    void endSending() noexcept                  { sender = Sender::none; }
+    
+    // What the message thread (or a port watcher) asked the sending thread to
+    // do with the console; only the latest request counts
+    enum class ConsoleRequest { none, activate, resume, deactivate };
+    std::atomic<ConsoleRequest> consoleRequest { ConsoleRequest::none };
+    
+    /** Records whether the console is driven and leaves the request for the sending thread */
+    void requestConsole(ConsoleRequest request);
+    
+    /**
+     * Carries out any console request, then sends every parameter changed
+     * since the last call (between begin/endSending)
+     */
+    void sendChangedParameters();
+    
+    void timerCallback() override;
+    
+    /** Starts journalling under a fresh ID, if setStateInformation() hasn't opened one */
+    void openJournal();
+    
+    /** Checkpoints the journal with the current values */
+    void checkpointJournal();
+    
+    /**
+     * Continues the journal named in a loaded state. If that session crashed,
+     * its last values are written into the state before it is applied, and
+     * the console request to make once it has been is returned: a console it
+     * left running is resumed without resending anything if the crash was
+     * within warmResumeWindowMs and the ports don't show the console down;
+     * otherwise it's activated again.
+     */
+    ConsoleRequest resumeJournal(juce::ValueTree& state);
+    
+    static constexpr int warmResumeWindowMs = 5 * 60 * 1000;
+    
+    void getCurrentParameterValues(SceneLibrary::SceneValues& values) const;
+    void applyParameterValues(const SceneLibrary::SceneValues& values);
+    
+    // AudioProcessorParameter::Listener implementation (parameters report their index)
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+    void parameterGestureChanged(int parameterIndex, bool gestureIsStarting) override;
     
     //==============================================================================
-    // Console state
-    bool consoleActive = false;
+    // Console state (read by the sending thread)
+    std::atomic<bool> consoleActive { false };
     bool testModeEnabled = false;
     bool allMutesState = false;
     
@@ -142,11 +270,19 @@ private:
     int sampleCounter = 0;
     int faderAnimRate = 0;
     int muteAnimRate = 0;
-    std::array<float, 72> animPhase;
+    std::array<float, CinemixConsole::numFaders> animPhase;
+    juce::Random animRandom;  // Seeded once, not on the audio thread for every call
     
     void animateFaders();
     void animateMutes();
     
+    //==============================================================================
+    // Scene library and morphing
+    juce::SharedResourcePointer<SceneLibrary> sceneLibrary;   // One per process, shared by all instances
+    SceneMorphEngine morphEngine;
+    SceneLibrary::SceneValues morphOutput;
+    int currentScene = 0;
+    
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CinemixBridgeProcessor)
 };
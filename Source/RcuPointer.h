@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - RcuPointer.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+
+//==============================================================================
+/**
+ * RcuPointer
+ *
+ * Owning pointer that can be replaced while other threads are using the
+ * object it points to (read-copy-update).
+ *
+ * Readers take a ReadHandle: one counter increment, one pointer load, and a
+ * decrement when the handle goes out of scope - no loops, locks or waits, so
+ * it is safe on the MIDI callback and audio threads.
+ *
+ * update() publishes the new object with a single atomic exchange, then
+ * waits for a grace period before deleting the old one. Readers register
+ * against one of two epochs; the writer flips the epoch twice and waits for
+ * each epoch's count to drain, after which no reader can still hold the old
+ * pointer. Only the writer ever waits.
+ *
+ * Don't call update() while the same thread holds a ReadHandle.
+ */
+template <typename ObjectType>
+class RcuPointer
+{
+public:
+    //==============================================================================
+    RcuPointer() = default;
+
+    explicit RcuPointer(std::unique_ptr<ObjectType> initialObject)
+        : current(initialObject.release())
+    {
+    }
+
+    ~RcuPointer()
+    {
+        delete current.load();
+    }
+
+    //==============================================================================
+    /** Keeps the object it was created with alive until it is destroyed */
+    class ReadHandle
+    {
+    public:
+        ~ReadHandle()
+        {
+            counter.fetch_sub(1, std::memory_order_release);
+        }
+
+        ObjectType* get() const noexcept            { return object; }
+        ObjectType* operator->() const noexcept     { return object; }
+        ObjectType& operator*() const noexcept      { return *object; }
+        explicit operator bool() const noexcept     { return object != nullptr; }
+
+    private:
+        friend class RcuPointer;
+
+        ReadHandle(std::atomic<int>& readerCounter, ObjectType* objectToRead) noexcept
+            : counter(readerCounter), object(objectToRead)
+        {
+        }
+
+        std::atomic<int>& counter;
+        ObjectType* object;
+
+        JUCE_DECLARE_NON_COPYABLE (ReadHandle)
+    };
+
+    /** Wait-free. The returned handle may hold nullptr. */
+    ReadHandle read() const noexcept
+    {
+        auto& counter = readers[epoch.load() & 1].count;
+        counter.fetch_add(1);
+        return ReadHandle(counter, current.load());
+    }
+
+    //==============================================================================
+    /**
+     * Publishes a new object (nullptr is allowed) and deletes the previous one
+     * once no reader can still see it. Blocks the calling thread, never readers.
+     */
+    void update(std::unique_ptr<ObjectType> newObject)
+    {
+        const juce::ScopedLock sl(writerLock);
+
+        auto* oldObject = current.exchange(newObject.release());
+        waitForReaders();
+        delete oldObject;
+    }
+
+private:
+    //==============================================================================
+    struct alignas(64) ReaderCount
+    {
+        std::atomic<int> count { 0 };
+    };
+
+    std::atomic<ObjectType*> current { nullptr };
+    mutable std::atomic<juce::uint32> epoch { 0 };
+    mutable std::array<ReaderCount, 2> readers;
+    juce::CriticalSection writerLock;
+
+    void waitForReaders()
+    {
+        // A reader that sampled the epoch just before a flip may register late,
+        // but it then loads the new pointer; flipping twice drains both counters
+        for (int flip = 0; flip < 2; ++flip)
+        {
+            auto previousEpoch = epoch.fetch_add(1);
+
+            while (readers[previousEpoch & 1].count.load() != 0)
+                juce::Thread::yield();
+        }
+    }
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE (RcuPointer)
+};
@@ -0,0 +1,343 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - RealtimeAudit.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "RealtimeAudit.h"
+
+#if CINEMIX_RT_AUDIT
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if JUCE_LINUX || JUCE_MAC
+ #include <cxxabi.h>
+ #include <execinfo.h>
+#endif
+
+#if JUCE_LINUX
+ #include <dlfcn.h>
+ #include <poll.h>
+ #include <pthread.h>
+ #include <semaphore.h>
+ #include <sys/select.h>
+ #include <time.h>
+ #include <unistd.h>
+#endif
+
+namespace
+{
+    //==============================================================================
+    struct ThreadState
+    {
+        const char* scopeName = nullptr;    // Innermost open scope, or nullptr
+        bool allowed = false;               // Inside CINEMIX_RT_AUDIT_ALLOW
+        bool recording = false;             // Inside check(), which may itself allocate
+    };
+
+    // Constant-initialised, so reading it never allocates
+    thread_local ThreadState threadState;
+
+    constexpr int maxRecorded = 64;
+    constexpr int maxFrames = 32;
+
+    struct Violation
+    {
+        RealtimeAudit::Kind kind;
+        const char* scopeName;
+        const char* what;
+        void* frames[maxFrames];
+        int numFrames;
+    };
+
+    // Filled from any thread; only read by createReport() once they're done
+    Violation recorded[maxRecorded];
+    std::atomic<int> numViolations { 0 };
+    std::atomic<int> kindCounts[3] {};
+
+    const char* getKindName(RealtimeAudit::Kind kind)
+    {
+        switch (kind)
+        {
+            case RealtimeAudit::Kind::allocation:   return "allocation";
+            case RealtimeAudit::Kind::lock:         return "lock";
+            case RealtimeAudit::Kind::blockingCall: return "blocking call";
+        }
+
+        return "";
+    }
+
+   #if JUCE_LINUX || JUCE_MAC
+    /** "binary(mangled+0x12) [0x...]" -> "binary: demangled +0x12" where possible */
+    juce::String describeFrame(const char* symbol)
+    {
+        juce::String text(symbol);
+        auto mangled = text.fromFirstOccurrenceOf("(", false, false).upToFirstOccurrenceOf("+", false, false);
+
+        if (mangled.isEmpty())
+            return text;
+
+        int status = 0;
+        auto* demangled = abi::__cxa_demangle(mangled.toRawUTF8(), nullptr, nullptr, &status);
+
+        if (demangled == nullptr)
+            return text;
+
+        juce::String result;
+        result << text.upToFirstOccurrenceOf("(", false, false) << ": " << demangled << " "
+               << text.fromLastOccurrenceOf("+", true, false).upToFirstOccurrenceOf(")", false, false);
+
+        std::free(demangled);
+        return result;
+    }
+   #endif
+}
+
+//==============================================================================
+RealtimeAudit::Scope::Scope(const char* name) noexcept
+    : previousName(threadState.scopeName),
+      previousAllowed(threadState.allowed)
+{
+    threadState.scopeName = name;
+    threadState.allowed = false;
+}
+
+RealtimeAudit::Scope::~Scope() noexcept
+{
+    threadState.scopeName = previousName;
+    threadState.allowed = previousAllowed;
+}
+
+RealtimeAudit::AllowedCall::AllowedCall(const char* reason) noexcept
+    : previousAllowed(threadState.allowed)
+{
+    juce::ignoreUnused(reason);
+    threadState.allowed = true;
+}
+
+RealtimeAudit::AllowedCall::~AllowedCall() noexcept
+{
+    threadState.allowed = previousAllowed;
+}
+
+//==============================================================================
+void RealtimeAudit::check(Kind kind, const char* what) noexcept
+{
+    auto& state = threadState;
+
+    if (state.scopeName == nullptr || state.allowed || state.recording)
+        return;
+
+    state.recording = true;
+    kindCounts[(int) kind].fetch_add(1, std::memory_order_relaxed);
+
+    auto index = numViolations.fetch_add(1);
+
+    if (index < maxRecorded)
+    {
+        auto& violation = recorded[index];
+        violation.kind = kind;
+        violation.scopeName = state.scopeName;
+        violation.what = what;
+
+       #if JUCE_LINUX || JUCE_MAC
+        violation.numFrames = backtrace(violation.frames, maxFrames);
+       #else
+        violation.numFrames = 0;
+       #endif
+    }
+
+    state.recording = false;
+}
+
+void RealtimeAudit::reset()
+{
+   #if JUCE_LINUX || JUCE_MAC
+    // The first backtrace() loads the unwinder; get that over with here
+    void* frames[4];
+    backtrace(frames, 4);
+   #endif
+
+    numViolations = 0;
+
+    for (auto& count : kindCounts)
+        count = 0;
+}
+
+int RealtimeAudit::getNumViolations() noexcept
+{
+    return numViolations.load();
+}
+
+juce::String RealtimeAudit::createReport()
+{
+    auto total = getNumViolations();
+
+    juce::String report;
+    report << "Realtime violations: " << total << " ("
+           << kindCounts[(int) Kind::allocation].load() << " allocations, "
+           << kindCounts[(int) Kind::lock].load() << " locks, "
+           << kindCounts[(int) Kind::blockingCall].load() << " blocking calls)\n";
+
+    for (int i = 0; i < juce::jmin(total, maxRecorded); ++i)
+    {
+        const auto& violation = recorded[i];
+
+        report << "\n#" << (i + 1) << " " << getKindName(violation.kind) << " (" << violation.what
+               << ") in " << violation.scopeName << "\n";
+
+       #if JUCE_LINUX || JUCE_MAC
+        // Frame 0 is check() itself; frame 1 the hook that caught the call
+        if (auto** symbols = backtrace_symbols(violation.frames, violation.numFrames))
+        {
+            for (int frame = 1; frame < violation.numFrames; ++frame)
+                report << "    " << describeFrame(symbols[frame]) << "\n";
+
+            std::free(symbols);
+        }
+       #endif
+    }
+
+    if (total > maxRecorded)
+        report << "\n(only the first " << maxRecorded << " are listed)\n";
+
+    return report;
+}
+
+//==============================================================================
+// Hooks
+
+#if JUCE_LINUX
+// The C library's allocator, reached without going through the hooks below
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void __libc_free(void*);
+
+namespace
+{
+    /** The next definition of a C library function (the real one) */
+    void* getNext(std::atomic<void*>& cached, const char* name) noexcept
+    {
+        auto* function = cached.load(std::memory_order_acquire);
+
+        if (function == nullptr)
+        {
+            function = dlsym(RTLD_NEXT, name);
+            cached.store(function, std::memory_order_release);
+        }
+
+        return function;
+    }
+}
+
+#define CINEMIX_RT_AUDIT_FORWARD(kind, name, ...) \
+    RealtimeAudit::check(RealtimeAudit::Kind::kind, #name); \
+    static std::atomic<void*> next { nullptr }; \
+    return reinterpret_cast<decltype(&name)>(getNext(next, #name))(__VA_ARGS__);
+
+// Allocation: covers operator new (which calls malloc) and C code alike
+extern "C" void* malloc(size_t size)
+{
+    RealtimeAudit::check(RealtimeAudit::Kind::allocation, "malloc");
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+    RealtimeAudit::check(RealtimeAudit::Kind::allocation, "calloc");
+    return __libc_calloc(count, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size)
+{
+    RealtimeAudit::check(RealtimeAudit::Kind::allocation, "realloc");
+    return __libc_realloc(pointer, size);
+}
+
+extern "C" int posix_memalign(void** pointer, size_t alignment, size_t size)    { CINEMIX_RT_AUDIT_FORWARD(allocation, posix_memalign, pointer, alignment, size) }
+extern "C" void* aligned_alloc(size_t alignment, size_t size)                 { CINEMIX_RT_AUDIT_FORWARD(allocation, aligned_alloc, alignment, size) }
+
+extern "C" void free(void* pointer)
+{
+    if (pointer != nullptr)
+        RealtimeAudit::check(RealtimeAudit::Kind::allocation, "free");
+
+    __libc_free(pointer);
+}
+
+// Locks (try-locks never wait, so they're allowed)
+extern "C" int pthread_mutex_lock(pthread_mutex_t* mutex)                 { CINEMIX_RT_AUDIT_FORWARD(lock, pthread_mutex_lock, mutex) }
+extern "C" int pthread_rwlock_rdlock(pthread_rwlock_t* rwlock)            { CINEMIX_RT_AUDIT_FORWARD(lock, pthread_rwlock_rdlock, rwlock) }
+extern "C" int pthread_rwlock_wrlock(pthread_rwlock_t* rwlock)            { CINEMIX_RT_AUDIT_FORWARD(lock, pthread_rwlock_wrlock, rwlock) }
+extern "C" int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex)  { CINEMIX_RT_AUDIT_FORWARD(lock, pthread_cond_wait, cond, mutex) }
+extern "C" int pthread_cond_timedwait(pthread_cond_t* cond, pthread_mutex_t* mutex, const struct timespec* time)
+                                                                          { CINEMIX_RT_AUDIT_FORWARD(lock, pthread_cond_timedwait, cond, mutex, time) }
+extern "C" int sem_wait(sem_t* semaphore)                                 { CINEMIX_RT_AUDIT_FORWARD(lock, sem_wait, semaphore) }
+extern "C" int sem_timedwait(sem_t* semaphore, const struct timespec* time)     { CINEMIX_RT_AUDIT_FORWARD(lock, sem_timedwait, semaphore, time) }
+
+// Blocking system calls
+extern "C" int nanosleep(const struct timespec* duration, struct timespec* remaining)   { CINEMIX_RT_AUDIT_FORWARD(blockingCall, nanosleep, duration, remaining) }
+extern "C" int clock_nanosleep(clockid_t clock, int flags, const struct timespec* time, struct timespec* remaining)
+                                                                          { CINEMIX_RT_AUDIT_FORWARD(blockingCall, clock_nanosleep, clock, flags, time, remaining) }
+extern "C" int usleep(useconds_t micros)                                  { CINEMIX_RT_AUDIT_FORWARD(blockingCall, usleep, micros) }
+extern "C" ssize_t read(int fd, void* buffer, size_t size)                { CINEMIX_RT_AUDIT_FORWARD(blockingCall, read, fd, buffer, size) }
+extern "C" ssize_t write(int fd, const void* buffer, size_t size)         { CINEMIX_RT_AUDIT_FORWARD(blockingCall, write, fd, buffer, size) }
+extern "C" int poll(struct pollfd* fds, nfds_t numFds, int timeout)       { CINEMIX_RT_AUDIT_FORWARD(blockingCall, poll, fds, numFds, timeout) }
+extern "C" int select(int numFds, fd_set* readFds, fd_set* writeFds, fd_set* exceptFds, struct timeval* timeout)
+                                                                          { CINEMIX_RT_AUDIT_FORWARD(blockingCall, select, numFds, readFds, writeFds, exceptFds, timeout) }
+
+#undef CINEMIX_RT_AUDIT_FORWARD
+
+#else
+// Elsewhere only C++ allocations are seen
+void* operator new(std::size_t size)
+{
+    RealtimeAudit::check(RealtimeAudit::Kind::allocation, "operator new");
+
+    if (auto* pointer = std::malloc(size > 0 ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    RealtimeAudit::check(RealtimeAudit::Kind::allocation, "operator new");
+    return std::malloc(size > 0 ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer != nullptr)
+        RealtimeAudit::check(RealtimeAudit::Kind::allocation, "operator delete");
+
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept                  { operator delete(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept       { operator delete(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept     { operator delete(pointer); }
+#endif
+
+#endif
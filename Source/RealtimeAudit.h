@@ -0,0 +1,108 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - RealtimeAudit.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Audit build: counts what realtime code must never do (see RealtimeAudit)
+#ifndef CINEMIX_RT_AUDIT
+ #define CINEMIX_RT_AUDIT 0
+#endif
+
+//==============================================================================
+/**
+ * RealtimeAudit
+ *
+ * Checks that the audio and MIDI threads never allocate, lock or block.
+ *
+ * Code that must be realtime-safe opens a scope with
+ * CINEMIX_RT_AUDIT_SCOPE("name"). In builds with CINEMIX_RT_AUDIT=1, the
+ * following are recorded as violations while a scope is open on the
+ * calling thread:
+ * - heap allocations and frees (global operator new / delete);
+ * - mutex, read-write lock, condition variable and semaphore waits;
+ * - sleeps and blocking I/O (read, write, poll, select).
+ *
+ * Each violation keeps the scope it happened in and a stack trace of the
+ * call site.
+ *
+ * Locks and system calls are caught by interposing the C library
+ * functions. That needs the audit code to be linked into the executable,
+ * so use the Standalone app ("--rt-audit" drives the processor and prints
+ * the report), and Linux for anything beyond allocations.
+ *
+ * Calls into the host that are allowed to lock (JUCE's parameter listener
+ * lock, for example) are wrapped in CINEMIX_RT_AUDIT_ALLOW("reason"). A
+ * scope opened inside one, such as the processor's own parameter listener,
+ * is audited again.
+ *
+ * Without CINEMIX_RT_AUDIT both macros compile to nothing.
+ */
+namespace RealtimeAudit
+{
+    enum class Kind
+    {
+        allocation,
+        lock,
+        blockingCall
+    };
+
+    /** Marks the calling thread as realtime until destroyed (nestable) */
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name) noexcept;
+        ~Scope() noexcept;
+
+    private:
+        const char* previousName;
+        bool previousAllowed;
+
+        JUCE_DECLARE_NON_COPYABLE (Scope)
+    };
+
+    /** Lets the calling thread allocate or lock until destroyed */
+    class AllowedCall
+    {
+    public:
+        explicit AllowedCall(const char* reason) noexcept;
+        ~AllowedCall() noexcept;
+
+    private:
+        bool previousAllowed;
+
+        JUCE_DECLARE_NON_COPYABLE (AllowedCall)
+    };
+
+    /** Records a violation if the calling thread is in an audited scope */
+    void check(Kind kind, const char* what) noexcept;
+
+    /** Clears every recorded violation and count */
+    void reset();
+
+    /** Number of violations recorded since the last reset() */
+    int getNumViolations() noexcept;
+
+    /** Counts per kind, then each recorded violation with its stack trace */
+    juce::String createReport();
+}
+
+#if CINEMIX_RT_AUDIT
+ #define CINEMIX_RT_AUDIT_SCOPE(name)   const RealtimeAudit::Scope JUCE_JOIN_MACRO (realtimeAuditScope_, __LINE__) { name }
+ #define CINEMIX_RT_AUDIT_ALLOW(reason) const RealtimeAudit::AllowedCall JUCE_JOIN_MACRO (realtimeAuditAllowed_, __LINE__) { reason }
+#else
+ #define CINEMIX_RT_AUDIT_SCOPE(name)
+ #define CINEMIX_RT_AUDIT_ALLOW(reason)
+#endif
@@ -0,0 +1,362 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - SceneLibrary.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "SceneLibrary.h"
+
+//==============================================================================
+SceneLibrary::SceneLibrary()
+{
+}
+
+SceneLibrary::~SceneLibrary()
+{
+    close();
+}
+
+juce::File SceneLibrary::getDefaultLibraryFile()
+{
+    // Scenes only fit the frame size they were stored on, so other frames get their own file
+    juce::String fileName = CinemixConsole::numChannels == 36
+                                ? "Scenes.cmxscenes"
+                                : "Scenes_" + juce::String(CinemixConsole::numChannels) + "ch.cmxscenes";
+    
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+               .getChildFile("CinemixAutomationBridge")
+               .getChildFile(fileName);
+}
+
+//==============================================================================
+// File Management
+
+bool SceneLibrary::open(const juce::File& libraryFile)
+{
+    close();
+
+    const juce::ScopedWriteLock sl(mappingLock);
+
+    // Named after the file, so every process using it shares the lock
+    fileLock = std::make_unique<juce::InterProcessLock>("CinemixBridgeScenes_"
+                                                        + juce::String::toHexString(libraryFile.getFullPathName().hashCode64()));
+
+    {
+        const juce::InterProcessLock::ScopedLockType lock(*fileLock);
+
+        if (!libraryFile.existsAsFile() && !createEmptyLibrary(libraryFile))
+        {
+            fileLock.reset();
+            return false;
+        }
+    }
+
+    file = libraryFile;
+
+    if (!mapFile())
+    {
+        fileLock.reset();
+        file = juce::File();
+        return false;
+    }
+
+    // Reject files from other tools or with a different parameter count
+    auto* header = getHeader();
+    if (std::memcmp(header->magic, "CMXS", 4) != 0
+        || header->version != currentVersion
+        || header->valuesPerScene != (juce::uint32) numSceneValues
+        || header->numScenes > header->capacity)
+    {
+        mappedFile.reset();
+        fileLock.reset();
+        file = juce::File();
+        return false;
+    }
+
+    return true;
+}
+
+void SceneLibrary::close()
+{
+    const juce::ScopedWriteLock sl(mappingLock);
+
+    mappedFile.reset();
+    fileLock.reset();
+    file = juce::File();
+}
+
+bool SceneLibrary::isOpen() const
+{
+    const juce::ScopedReadLock sl(mappingLock);
+    return mappedFile != nullptr;
+}
+
+bool SceneLibrary::isOpen(const juce::File& libraryFile) const
+{
+    const juce::ScopedReadLock sl(mappingLock);
+    return mappedFile != nullptr && file == libraryFile;
+}
+
+juce::File SceneLibrary::getFile() const
+{
+    const juce::ScopedReadLock sl(mappingLock);
+    return file;
+}
+
+bool SceneLibrary::createEmptyLibrary(const juce::File& libraryFile)
+{
+    if (libraryFile.getParentDirectory().createDirectory().failed())
+        return false;
+
+    juce::FileOutputStream out(libraryFile);
+    if (out.failedToOpen())
+        return false;
+
+    Header header {};
+    std::memcpy(header.magic, "CMXS", 4);
+    header.version = currentVersion;
+    header.numScenes = 0;
+    header.capacity = (juce::uint32) initialCapacity;
+    header.valuesPerScene = (juce::uint32) numSceneValues;
+
+    out.write(&header, sizeof(header));
+    out.writeRepeatedByte(0, sizeof(Record) * (size_t) initialCapacity);
+    out.flush();
+
+    return out.getStatus().wasOk();
+}
+
+bool SceneLibrary::mapFile() const
+{
+    mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readWrite);
+
+    if (mappedFile->getData() == nullptr || mappedFile->getSize() < sizeof(Header))
+    {
+        mappedFile.reset();
+        return false;
+    }
+
+    auto capacity = (size_t) getHeader()->capacity;
+    if (mappedFile->getSize() < sizeof(Header) + capacity * sizeof(Record))
+    {
+        mappedFile.reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool SceneLibrary::refreshMapping() const
+{
+    {
+        const juce::ScopedReadLock sl(mappingLock);
+
+        if (mappedFile == nullptr)
+            return false;
+
+        // The header is always mapped; the records only up to the size mapped
+        if ((int) getHeader()->capacity <= getMappedCapacity())
+            return true;
+    }
+
+    // Grown: remap once no other thread is reading
+    const juce::ScopedWriteLock sl(mappingLock);
+    return remapIfGrown();
+}
+
+bool SceneLibrary::remapIfGrown() const
+{
+    if (mappedFile != nullptr && (int) getHeader()->capacity > getMappedCapacity())
+        mapFile();
+
+    return mappedFile != nullptr;
+}
+
+bool SceneLibrary::growCapacity()
+{
+    // Double the record area (under both locks). The mapping has to be
+    // dropped while the file is extended, then re-established over the larger
+    // file. Other processes see the file grow before the new capacity, so
+    // their mappings never claim records the file doesn't have.
+    auto newCapacity = getHeader()->capacity * 2;
+    auto newSize = (juce::int64) (sizeof(Header) + sizeof(Record) * (size_t) newCapacity);
+
+    mappedFile.reset();
+
+    {
+        juce::FileOutputStream out(file);  // Opens positioned at end of file
+        if (out.failedToOpen())
+        {
+            mapFile();
+            return false;
+        }
+
+        if (newSize > out.getPosition())
+            out.writeRepeatedByte(0, (size_t) (newSize - out.getPosition()));
+
+        out.flush();
+    }
+
+    if (!mapFile())
+        return false;
+
+    getHeader()->capacity = newCapacity;
+    return true;
+}
+
+//==============================================================================
+// Record Access
+
+SceneLibrary::Header* SceneLibrary::getHeader() const
+{
+    return static_cast<Header*>(mappedFile->getData());
+}
+
+SceneLibrary::Record* SceneLibrary::getRecord(int index) const
+{
+    auto* base = static_cast<char*>(mappedFile->getData()) + sizeof(Header);
+    return reinterpret_cast<Record*>(base) + index;
+}
+
+int SceneLibrary::getMappedCapacity() const
+{
+    return (int) ((mappedFile->getSize() - sizeof(Header)) / sizeof(Record));
+}
+
+int SceneLibrary::getMappedNumScenes() const
+{
+    // Bounded by this mapping too, whatever another process has written
+    return juce::jmin((int) getHeader()->numScenes, getMappedCapacity());
+}
+
+int SceneLibrary::getNumScenes() const
+{
+    if (!refreshMapping())
+        return 0;
+
+    const juce::ScopedReadLock sl(mappingLock);
+    return mappedFile != nullptr ? getMappedNumScenes() : 0;
+}
+
+juce::String SceneLibrary::getSceneName(int index) const
+{
+    if (!refreshMapping())
+        return {};
+
+    const juce::ScopedReadLock sl(mappingLock);
+
+    if (mappedFile == nullptr || !juce::isPositiveAndBelow(index, getMappedNumScenes()))
+        return {};
+
+    const auto* record = getRecord(index);
+    return juce::String::fromUTF8(record->name, (int) strnlen(record->name, maxNameBytes));
+}
+
+void SceneLibrary::setSceneName(int index, const juce::String& newName)
+{
+    const juce::ScopedWriteLock sl(mappingLock);
+
+    if (mappedFile == nullptr)
+        return;
+
+    const juce::InterProcessLock::ScopedLockType lock(*fileLock);
+
+    if (!remapIfGrown() || !juce::isPositiveAndBelow(index, getMappedNumScenes()))
+        return;
+
+    auto* record = getRecord(index);
+    std::memset(record->name, 0, maxNameBytes);
+    newName.copyToUTF8(record->name, maxNameBytes);
+}
+
+bool SceneLibrary::getSceneValues(int index, SceneValues& destValues) const
+{
+    if (!refreshMapping())
+        return false;
+
+    const juce::ScopedReadLock sl(mappingLock);
+
+    if (mappedFile == nullptr || !juce::isPositiveAndBelow(index, getMappedNumScenes()))
+        return false;
+
+    std::memcpy(destValues.data(), getRecord(index)->values, sizeof(float) * numSceneValues);
+    return true;
+}
+
+int SceneLibrary::addScene(const juce::String& name, const SceneValues& values)
+{
+    const juce::ScopedWriteLock sl(mappingLock);
+
+    if (mappedFile == nullptr)
+        return -1;
+
+    // Another process may be adding or growing at the same time
+    const juce::InterProcessLock::ScopedLockType lock(*fileLock);
+
+    if (!remapIfGrown())
+        return -1;
+
+    if (getHeader()->numScenes >= getHeader()->capacity && !growCapacity())
+        return -1;
+
+    int index = (int) getHeader()->numScenes;
+
+    auto* record = getRecord(index);
+    std::memset(record->name, 0, maxNameBytes);
+    name.copyToUTF8(record->name, maxNameBytes);
+    record->flags = 0;
+    std::memcpy(record->values, values.data(), sizeof(float) * numSceneValues);
+
+    // Publish the count last, so a half-written record is never visible
+    getHeader()->numScenes = (juce::uint32) index + 1;
+
+    return index;
+}
+
+bool SceneLibrary::replaceScene(int index, const SceneValues& values)
+{
+    const juce::ScopedWriteLock sl(mappingLock);
+
+    if (mappedFile == nullptr)
+        return false;
+
+    const juce::InterProcessLock::ScopedLockType lock(*fileLock);
+
+    if (!remapIfGrown() || !juce::isPositiveAndBelow(index, getMappedNumScenes()))
+        return false;
+
+    std::memcpy(getRecord(index)->values, values.data(), sizeof(float) * numSceneValues);
+    return true;
+}
+
+bool SceneLibrary::removeScene(int index)
+{
+    const juce::ScopedWriteLock sl(mappingLock);
+
+    if (mappedFile == nullptr)
+        return false;
+
+    const juce::InterProcessLock::ScopedLockType lock(*fileLock);
+
+    if (!remapIfGrown())
+        return false;
+
+    int numScenes = getMappedNumScenes();
+    if (!juce::isPositiveAndBelow(index, numScenes))
+        return false;
+
+    std::memmove(getRecord(index), getRecord(index + 1),
+                 sizeof(Record) * (size_t) (numScenes - index - 1));
+    std::memset(getRecord(numScenes - 1), 0, sizeof(Record));
+
+    getHeader()->numScenes = (juce::uint32) numScenes - 1;
+    return true;
+}
@@ -0,0 +1,145 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - SceneLibrary.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "ConsoleLayout.h"
+
+//==============================================================================
+/**
+ * SceneLibrary
+ *
+ * Stores complete console mix states ("scenes") as fixed-size records in a
+ * single library file. The file is memory-mapped, so opening a library of
+ * thousands of scenes costs one mmap call rather than a parse.
+ *
+ * File layout:
+ * - Header (32 bytes): magic "CMXS", version, scene count, capacity, values per scene
+ * - Records: name (60 bytes, UTF-8, null-terminated) + flags + one float per parameter
+ *
+ * Every plugin instance shares the same file, across processes too. Within a
+ * process there's one library, held through juce::SharedResourcePointer.
+ * Changes to the file (adding, growing, renaming, removing) are made under
+ * an inter-process lock, and a library remaps the file whenever another
+ * process has grown it, so no access ever goes past the end of a mapping.
+ *
+ * Within the process, lookups hold a read lock on the mapping and changes
+ * (and remapping) a write lock, so one instance growing the file never
+ * unmaps it under another instance reading. Any thread may call any method.
+ */
+class SceneLibrary
+{
+public:
+    //==============================================================================
+    static constexpr int numSceneValues = CinemixConsole::totalParameters;
+    static constexpr int maxNameBytes = 60;
+
+    using SceneValues = std::array<float, numSceneValues>;
+
+    //==============================================================================
+    SceneLibrary();
+    ~SceneLibrary();
+
+    /** Returns the default library location in the user's application data folder */
+    static juce::File getDefaultLibraryFile();
+
+    /** Opens (or creates) a library file. Returns false if the file is unusable. */
+    bool open(const juce::File& libraryFile);
+
+    /** Unmaps the library file */
+    void close();
+
+    bool isOpen() const;
+    bool isOpen(const juce::File& libraryFile) const;
+    juce::File getFile() const;
+
+    //==============================================================================
+    int getNumScenes() const;
+
+    juce::String getSceneName(int index) const;
+    void setSceneName(int index, const juce::String& newName);
+
+    /** Copies a scene's parameter values. Returns false for an invalid index. */
+    bool getSceneValues(int index, SceneValues& destValues) const;
+
+    /** Appends a new scene and returns its index (-1 on failure) */
+    int addScene(const juce::String& name, const SceneValues& values);
+
+    /** Overwrites the values of an existing scene */
+    bool replaceScene(int index, const SceneValues& values);
+
+    /** Removes a scene, shifting later scenes down by one */
+    bool removeScene(int index);
+
+private:
+    //==============================================================================
+    struct Header
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::uint32 numScenes;
+        juce::uint32 capacity;
+        juce::uint32 valuesPerScene;
+        juce::uint32 reserved[3];
+    };
+
+    struct Record
+    {
+        char name[maxNameBytes];
+        juce::uint32 flags;
+        float values[numSceneValues];
+    };
+
+    static_assert(sizeof(Header) == 32, "Scene library header must stay 32 bytes");
+    static_assert(std::is_trivially_copyable<Record>::value, "Scene records are copied as raw bytes");
+
+    static constexpr juce::uint32 currentVersion = 1;
+    static constexpr int initialCapacity = 64;
+
+    //==============================================================================
+    juce::File file;
+    std::unique_ptr<juce::InterProcessLock> fileLock;
+
+    // Read-locked to use the mapping, write-locked to replace it or change
+    // the file (the inter-process lock doesn't exclude threads of this process)
+    juce::ReadWriteLock mappingLock;
+
+    // Replaced when the file grows, here or in another process (see refreshMapping)
+    mutable std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+
+    // These need mappingLock held (and a mapping)
+    Header* getHeader() const;
+    Record* getRecord(int index) const;
+
+    /** Records the current mapping covers, whatever the header says */
+    int getMappedCapacity() const;
+
+    /** The scene count, bounded by the mapping too */
+    int getMappedNumScenes() const;
+
+    /** Remaps if the header's capacity is more than the mapping covers; false if closed */
+    bool refreshMapping() const;
+
+    /** As refreshMapping(), with the write lock already held */
+    bool remapIfGrown() const;
+
+    bool createEmptyLibrary(const juce::File& libraryFile);
+    bool mapFile() const;
+    bool growCapacity();
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SceneLibrary)
+};
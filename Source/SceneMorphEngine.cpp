@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - SceneMorphEngine.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "SceneMorphEngine.h"
+
+//==============================================================================
+SceneMorphEngine::SceneMorphEngine()
+{
+}
+
+void SceneMorphEngine::prepare(double sampleRate)
+{
+    const juce::SpinLock::ScopedLockType sl(lock);
+    samplesPerTick = juce::jmax(1, static_cast<int>(sampleRate / controlRateHz));
+    sampleCounter = 0;
+}
+
+void SceneMorphEngine::start(const SceneValues& fromValues, const SceneValues& toValues,
+                             double durationSeconds)
+{
+    const juce::SpinLock::ScopedLockType sl(lock);
+
+    // delta = to - from, computed once so each tick is a single multiply-add
+    startValues = fromValues;
+    juce::FloatVectorOperations::subtract(deltaValues.data(), toValues.data(),
+                                          fromValues.data(), SceneLibrary::numSceneValues);
+
+    totalTicks = juce::jmax(1, juce::roundToInt(durationSeconds * controlRateHz));
+    tickIndex = 0;
+    sampleCounter = 0;
+
+    active.store(true);
+}
+
+void SceneMorphEngine::stop()
+{
+    active.store(false);
+}
+
+bool SceneMorphEngine::process(int numSamples, SceneValues& outputValues)
+{
+    if (!active.load())
+        return false;
+
+    // Never wait on the message thread - if a new morph is being set up,
+    // pick it up on the next block instead
+    const juce::SpinLock::ScopedTryLockType sl(lock);
+    if (!sl.isLocked())
+        return false;
+
+    sampleCounter += numSamples;
+    if (sampleCounter < samplesPerTick)
+        return false;
+
+    // Catch up on every tick that elapsed in this block, but only output the latest
+    tickIndex = juce::jmin(totalTicks, tickIndex + sampleCounter / samplesPerTick);
+    sampleCounter %= samplesPerTick;
+
+    float position = static_cast<float>(tickIndex) / static_cast<float>(totalTicks);
+
+    // output = start + delta * position, over the whole parameter vector
+    juce::FloatVectorOperations::copy(outputValues.data(), startValues.data(),
+                                      SceneLibrary::numSceneValues);
+    juce::FloatVectorOperations::addWithMultiply(outputValues.data(), deltaValues.data(),
+                                                 position, SceneLibrary::numSceneValues);
+
+    if (tickIndex >= totalTicks)
+        active.store(false);
+
+    return true;
+}
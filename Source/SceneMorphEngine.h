@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - SceneMorphEngine.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SceneLibrary.h"
+
+//==============================================================================
+/**
+ * SceneMorphEngine
+ *
+ * Interpolates the full parameter vector between two scenes over a given
+ * time, producing a new vector at a fixed control rate. The interpolation
+ * is done over the whole array at once with FloatVectorOperations.
+ *
+ * start()/stop() are called from the message thread, process() from the
+ * audio thread. Mute values pass through the midpoint; the processor snaps
+ * them to off or on before they reach the parameters.
+ */
+class SceneMorphEngine
+{
+public:
+    //==============================================================================
+    using SceneValues = SceneLibrary::SceneValues;
+
+    /** Morph output rate - matches the test mode fader animation rate */
+    static constexpr double controlRateHz = 25.0;
+
+    //==============================================================================
+    SceneMorphEngine();
+
+    /** Must be called before process() whenever the sample rate changes */
+    void prepare(double sampleRate);
+
+    /** Starts a morph from one scene to another over the given duration */
+    void start(const SceneValues& fromValues, const SceneValues& toValues, double durationSeconds);
+
+    /** Cancels a running morph, leaving parameters where they are */
+    void stop();
+
+    bool isActive() const { return active.load(); }
+
+    /**
+     * Advances the morph by a block of samples. Returns true when a control
+     * tick elapsed and outputValues holds a new interpolated vector.
+     */
+    bool process(int numSamples, SceneValues& outputValues);
+
+private:
+    //==============================================================================
+    juce::SpinLock lock;
+    std::atomic<bool> active { false };
+
+    alignas(16) SceneValues startValues {};
+    alignas(16) SceneValues deltaValues {};
+
+    int samplesPerTick = 1920;
+    int sampleCounter = 0;
+    int tickIndex = 0;
+    int totalTicks = 1;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SceneMorphEngine)
+};
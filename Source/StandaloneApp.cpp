@@ -0,0 +1,486 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - StandaloneApp.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+
+#if JucePlugin_Build_Standalone && JUCE_USE_CUSTOM_PLUGIN_STANDALONE_APP
+
+#include <juce_audio_plugin_client/Standalone/juce_StandaloneFilterWindow.h>
+#include "BridgeDaemon.h"
+#include "ConsoleCodec.h"
+#include "LatencyProbe.h"
+#include "LoopbackTransport.h"
+#include "PluginProcessor.h"
+#include "RealtimeAudit.h"
+#include <thread>
+
+#if JUCE_LINUX || JUCE_BSD
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#elif JUCE_WINDOWS
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #include <windows.h>
+ #include <psapi.h>
+#endif
+
+namespace
+{
+    /** Resident set size of this process, or 0 where it can't be read */
+    juce::int64 getResidentBytes()
+    {
+       #if JUCE_LINUX || JUCE_BSD
+        long totalPages = 0, residentPages = 0;
+
+        if (auto* statm = std::fopen("/proc/self/statm", "r"))
+        {
+            auto fields = std::fscanf(statm, "%ld %ld", &totalPages, &residentPages);
+            std::fclose(statm);
+
+            if (fields == 2)
+                return (juce::int64) residentPages * (juce::int64) sysconf(_SC_PAGESIZE);
+        }
+
+        return 0;
+       #elif JUCE_MAC
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t) &info, &count) == KERN_SUCCESS)
+            return (juce::int64) info.resident_size;
+
+        return 0;
+       #elif JUCE_WINDOWS
+        PROCESS_MEMORY_COUNTERS counters {};
+
+        if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return (juce::int64) counters.WorkingSetSize;
+
+        return 0;
+       #else
+        return 0;
+       #endif
+    }
+}
+
+//==============================================================================
+/**
+ * CinemixStandaloneApp
+ *
+ * The usual JUCE standalone window, plus five headless modes:
+ * - --daemon: opens no window and serves plugin instances through
+ *   BridgeDaemon until it is asked to quit.
+ * - --measure-instances[=N]: creates and then destroys N plugin instances
+ *   (30 by default), as a host scan or session load would, prints the time
+ *   each took and the resident memory they added, and quits.
+ * - --rt-audit: in a CINEMIX_RT_AUDIT=1 build, drives the processor with
+ *   host automation and console traffic, prints every allocation, lock and
+ *   blocking call made on the realtime paths (see RealtimeAudit), and exits
+ *   with 1 if there were any.
+ * - --codec-benchmark: encodes every parameter into byte buffers and decodes
+ *   them again with CinemixCodec, many times over, and prints the time per
+ *   parameter and the byte rate of each direction.
+ * - --latency-probe[=N]: moves console faders N times (200 by default) and
+ *   prints the distribution of the time until the console reports each one
+ *   (see LatencyProbe). The console's ports are given as
+ *   --ports=in1,in2,out1,out2 (device indices); --loopback[=ms] uses a
+ *   LoopbackTransport echoing after that delay instead, so the mode can run
+ *   without a console. Exits with 1 if no move was reported.
+ */
+class CinemixStandaloneApp : public juce::JUCEApplication
+{
+public:
+    //==============================================================================
+    CinemixStandaloneApp()
+    {
+        juce::PropertiesFile::Options options;
+        options.applicationName = juce::CharPointer_UTF8(JucePlugin_Name);
+        options.filenameSuffix = ".settings";
+        options.osxLibrarySubFolder = "Application Support";
+       #if JUCE_LINUX || JUCE_BSD
+        options.folderName = "~/.config";
+       #else
+        options.folderName = "";
+       #endif
+
+        appProperties.setStorageParameters(options);
+    }
+
+    const juce::String getApplicationName() override    { return juce::CharPointer_UTF8(JucePlugin_Name); }
+    const juce::String getApplicationVersion() override { return JucePlugin_VersionString; }
+    bool moreThanOneInstanceAllowed() override          { return true; }
+    void anotherInstanceStarted(const juce::String&) override {}
+
+    //==============================================================================
+    void initialise(const juce::String& commandLine) override
+    {
+        auto arguments = juce::StringArray::fromTokens(commandLine, true);
+
+        for (const auto& argument : arguments)
+        {
+            if (argument.startsWith("--measure-instances"))
+            {
+                auto count = argument.fromFirstOccurrenceOf("=", false, false).getIntValue();
+                measureInstances(count > 0 ? count : 30);
+                quit();
+                return;
+            }
+
+            if (argument == "--rt-audit")
+            {
+                setApplicationReturnValue(auditRealtimeSafety() ? 0 : 1);
+                quit();
+                return;
+            }
+
+            if (argument == "--codec-benchmark")
+            {
+                benchmarkCodec();
+                quit();
+                return;
+            }
+
+            if (argument.startsWith("--latency-probe"))
+            {
+                auto count = argument.fromFirstOccurrenceOf("=", false, false).getIntValue();
+                setApplicationReturnValue(probeLatency(arguments, count > 0 ? count : 200) ? 0 : 1);
+                quit();
+                return;
+            }
+        }
+
+        if (BridgeDaemon::isDaemonCommandLine(commandLine))
+        {
+            daemon = std::make_unique<BridgeDaemon>();
+
+            juce::String errorMessage;
+            if (!daemon->start(commandLine, errorMessage))
+            {
+                std::cerr << errorMessage << std::endl;
+                daemon.reset();
+                setApplicationReturnValue(1);
+                quit();
+            }
+
+            return;
+        }
+
+        mainWindow = std::make_unique<juce::StandaloneFilterWindow>(
+            getApplicationName(),
+            juce::LookAndFeel::getDefaultLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId),
+            appProperties.getUserSettings(),
+            false);
+
+        mainWindow->setVisible(true);
+    }
+
+    void shutdown() override
+    {
+        if (mainWindow != nullptr)
+            mainWindow->pluginHolder->savePluginState();
+
+        mainWindow = nullptr;
+        daemon = nullptr;
+        appProperties.saveIfNeeded();
+    }
+
+    void systemRequestedQuit() override
+    {
+        if (mainWindow != nullptr)
+            mainWindow->pluginHolder->savePluginState();
+
+        if (juce::ModalComponentManager::getInstance()->cancelAllModalComponents())
+        {
+            juce::Timer::callAfterDelay(100, []
+            {
+                if (auto* app = juce::JUCEApplicationBase::getInstance())
+                    app->systemRequestedQuit();
+            });
+        }
+        else
+        {
+            quit();
+        }
+    }
+
+private:
+    //==============================================================================
+    juce::ApplicationProperties appProperties;
+    std::unique_ptr<juce::StandaloneFilterWindow> mainWindow;
+    std::unique_ptr<BridgeDaemon> daemon;
+
+    //==============================================================================
+    static void measureInstances(int count)
+    {
+        std::vector<std::unique_ptr<juce::AudioProcessor>> instances;
+        std::vector<double> constructionMs, destructionMs;
+
+        // The first instance pays for the process-wide parts (port hub,
+        // threads), so it's created outside the memory measurement
+        auto firstStartMs = juce::Time::getMillisecondCounterHiRes();
+        instances.emplace_back(createPluginFilter());
+        constructionMs.push_back(juce::Time::getMillisecondCounterHiRes() - firstStartMs);
+
+        auto residentBefore = getResidentBytes();
+
+        // All alive at once, like a session with one instance per track
+        for (int i = 1; i < count; ++i)
+        {
+            auto startMs = juce::Time::getMillisecondCounterHiRes();
+            instances.emplace_back(createPluginFilter());
+            constructionMs.push_back(juce::Time::getMillisecondCounterHiRes() - startMs);
+        }
+
+        auto residentAfter = getResidentBytes();
+
+        for (auto& instance : instances)
+        {
+            auto startMs = juce::Time::getMillisecondCounterHiRes();
+            instance.reset();
+            destructionMs.push_back(juce::Time::getMillisecondCounterHiRes() - startMs);
+        }
+
+        double totalConstructionMs = 0.0, totalDestructionMs = 0.0;
+
+        for (int i = 0; i < count; ++i)
+        {
+            std::cout << "Instance " << (i + 1) << ": construct "
+                      << juce::String(constructionMs[(size_t) i], 3) << " ms, destroy "
+                      << juce::String(destructionMs[(size_t) i], 3) << " ms" << std::endl;
+
+            totalConstructionMs += constructionMs[(size_t) i];
+            totalDestructionMs += destructionMs[(size_t) i];
+        }
+
+        std::cout << count << " instances: construct " << juce::String(totalConstructionMs, 3)
+                  << " ms (" << juce::String(totalConstructionMs / count, 3) << " ms each), destroy "
+                  << juce::String(totalDestructionMs, 3) << " ms (" << juce::String(totalDestructionMs / count, 3)
+                  << " ms each)" << std::endl;
+
+        std::cout << "Processor object: " << (int) sizeof(CinemixBridgeProcessor) << " bytes; shared mapping table: "
+                  << (int) sizeof(MidiMappingTable) << " bytes (once per process)" << std::endl;
+
+        if (count > 1 && residentBefore > 0 && residentAfter > 0)
+            std::cout << "Resident memory: " << juce::String((residentAfter - residentBefore) / (count - 1))
+                      << " bytes per additional instance" << std::endl;
+        else
+            std::cout << "Resident memory: not available" << std::endl;
+    }
+
+    /** Returns true if no realtime path allocated, locked or blocked */
+    static bool auditRealtimeSafety()
+    {
+       #if CINEMIX_RT_AUDIT
+        constexpr double sampleRate = 48000.0;
+        constexpr int blockSize = 256;
+        constexpr int numBlocks = 20000;
+
+        std::unique_ptr<juce::AudioProcessor> instance(createPluginFilter());
+        auto& processor = static_cast<CinemixBridgeProcessor&>(*instance);
+        auto& parameters = processor.getParameters();
+
+        processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+        processor.prepareToPlay(sampleRate, blockSize);
+        processor.activateConsole();
+        processor.setTestMode(true);
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midiMessages;
+        buffer.clear();
+
+        RealtimeAudit::reset();
+
+        // Console moves, as the MIDI input thread would deliver them
+        std::atomic<bool> consoleRunning { true };
+        std::thread consoleThread([&processor, &consoleRunning]
+        {
+            juce::Random random(1);
+
+            while (consoleRunning.load())
+            {
+                auto message = juce::MidiMessage::controllerEvent(1 + random.nextInt(5), random.nextInt(128), random.nextInt(128));
+                processor.getMidiRouter().handleConsoleMessage(1 + random.nextInt(2), message);
+            }
+        });
+
+        // Host automation ahead of each block, as a plugin wrapper applies it
+        juce::Random random(2);
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                auto* parameter = parameters[random.nextInt(CinemixConsole::totalParameters)];
+                auto value = random.nextFloat();
+                parameter->setValue(value);
+                parameter->sendValueChangedMessageToListeners(value);
+            }
+
+            processor.processBlock(buffer, midiMessages);
+        }
+
+        consoleRunning = false;
+        consoleThread.join();
+
+        auto numViolations = RealtimeAudit::getNumViolations();
+        std::cout << RealtimeAudit::createReport() << std::endl;
+
+        processor.setTestMode(false);
+        processor.releaseResources();
+        return numViolations == 0;
+       #else
+        std::cerr << "--rt-audit needs a build with CINEMIX_RT_AUDIT=1" << std::endl;
+        return false;
+       #endif
+    }
+
+    static void benchmarkCodec()
+    {
+        using Layout = CinemixConsole;
+        constexpr int numPasses = 20000;
+        constexpr int bufferSize = Layout::totalParameters * CinemixCodec::maxBytesPerParameter;
+
+        // One stream per port, as the console's two ports would carry them
+        juce::uint8 bytes[2][bufferSize];
+        CinemixCodec::Event events[bufferSize / 2];
+        CinemixCodec::Decoder decoder;
+
+        std::array<float, Layout::totalParameters> values {};
+        double encodeMs = 0.0, decodeMs = 0.0;
+        juce::int64 numBytes = 0, numEvents = 0, checksum = 0;
+
+        for (int pass = 0; pass < numPasses; ++pass)
+        {
+            // Every value changes on every pass
+            for (int i = 0; i < Layout::totalParameters; ++i)
+                values[(size_t) i] = (float) ((i * 37 + pass) % 1000) / 999.0f;
+
+            int size[2] = {};
+            auto startMs = juce::Time::getMillisecondCounterHiRes();
+
+            for (int i = 0; i < Layout::totalParameters; ++i)
+            {
+                auto port = Layout::mappings[(size_t) i].portIndex - 1;
+                size[port] += CinemixCodec::encodeParameter(i, values[(size_t) i], bytes[port] + size[port], bufferSize - size[port]);
+            }
+
+            auto encodedMs = juce::Time::getMillisecondCounterHiRes();
+
+            for (int port = 0; port < 2; ++port)
+            {
+                auto count = decoder.decode(port + 1, bytes[port], size[port], events, bufferSize / 2);
+
+                for (int i = 0; i < count; ++i)
+                    checksum += events[i].paramIndex + (juce::int64) (events[i].value * 16383.0f);
+
+                numEvents += count;
+            }
+
+            auto decodedMs = juce::Time::getMillisecondCounterHiRes();
+            encodeMs += encodedMs - startMs;
+            decodeMs += decodedMs - encodedMs;
+            numBytes += size[0] + size[1];
+        }
+
+        auto numParameters = (double) numPasses * Layout::totalParameters;
+        auto megabytes = (double) numBytes / (1024.0 * 1024.0);
+
+        std::cout << numPasses << " passes over " << Layout::totalParameters << " parameters, "
+                  << numBytes << " bytes, " << numEvents << " events (checksum " << checksum << ")" << std::endl;
+        std::cout << "Encode: " << juce::String(encodeMs * 1.0e6 / numParameters, 2) << " ns per parameter, "
+                  << juce::String(megabytes / (encodeMs / 1000.0), 1) << " MB/s" << std::endl;
+        std::cout << "Decode: " << juce::String(decodeMs * 1.0e6 / numParameters, 2) << " ns per parameter, "
+                  << juce::String(megabytes / (decodeMs / 1000.0), 1) << " MB/s" << std::endl;
+    }
+
+    /** Returns true if at least one move was reported back */
+    static bool probeLatency(const juce::StringArray& arguments, int numMoves)
+    {
+        std::unique_ptr<LoopbackTransport> loopback;
+        juce::Array<int> portIndices;
+
+        for (const auto& argument : arguments)
+        {
+            if (argument.startsWith("--loopback"))
+                loopback = std::make_unique<LoopbackTransport>(argument.fromFirstOccurrenceOf("=", false, false).getDoubleValue());
+
+            if (argument.startsWith("--ports="))
+                for (const auto& index : juce::StringArray::fromTokens(argument.fromFirstOccurrenceOf("=", false, false), ",", ""))
+                    portIndices.add(index.getIntValue());
+        }
+
+        // Declared first so it outlives the router, which calls it until deleted
+        std::unique_ptr<LatencyProbe> probe;
+        auto router = loopback != nullptr ? std::make_unique<MidiRouter>(*loopback) : std::make_unique<MidiRouter>();
+        probe = std::make_unique<LatencyProbe>(*router);
+
+        if (loopback == nullptr)
+        {
+            if (portIndices.size() != 4)
+            {
+                std::cerr << "--latency-probe needs --ports=in1,in2,out1,out2 or --loopback" << std::endl;
+
+                juce::Thread::sleep(1000);   // Devices are enumerated in the background
+
+                auto inputs = router->getAvailableMidiInputs();
+                auto outputs = router->getAvailableMidiOutputs();
+
+                for (int i = 0; i < inputs.size(); ++i)
+                    std::cerr << "Input " << i << ": " << inputs[i] << std::endl;
+
+                for (int i = 0; i < outputs.size(); ++i)
+                    std::cerr << "Output " << i << ": " << outputs[i] << std::endl;
+
+                return false;
+            }
+
+            if (!router->openMidiPorts(portIndices[0], portIndices[1], portIndices[2], portIndices[3]))
+            {
+                std::cerr << "Couldn't open the console's ports" << std::endl;
+                return false;
+            }
+
+            router->sendInitializationSequence();
+            juce::Thread::sleep(500);
+        }
+
+        std::cout << router->getPortStatusString() << std::endl << std::endl;
+
+        LatencyProbe::Settings settings;
+        settings.numMoves = numMoves;
+
+        if (loopback != nullptr)
+            settings.settleMs = 0.0;
+
+        auto result = probe->measure(settings);
+        std::cout << result.createReport() << std::endl;
+
+        router->closeMidiPorts();
+        return !result.samples.isEmpty();
+    }
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CinemixStandaloneApp)
+};
+
+//==============================================================================
+juce::JUCEApplicationBase* juce_CreateApplication();
+juce::JUCEApplicationBase* juce_CreateApplication()
+{
+    return new CinemixStandaloneApp();
+}
+
+#endif
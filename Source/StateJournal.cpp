@@ -0,0 +1,348 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - StateJournal.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "StateJournal.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    constexpr juce::int64 staleJournalAgeMs = 30LL * 24 * 60 * 60 * 1000;
+
+    // IDs held by instances in this process (the inter-process lock is per process)
+    juce::CriticalSection& getClaimedIdLock()
+    {
+        static juce::CriticalSection lock;
+        return lock;
+    }
+
+    juce::StringArray& getClaimedIds()
+    {
+        static juce::StringArray ids;
+        return ids;
+    }
+
+    juce::String getLockName(const juce::String& journalId)
+    {
+        return "CinemixBridgeJournal_" + journalId;
+    }
+}
+
+//==============================================================================
+StateJournal::StateJournal() = default;
+
+StateJournal::~StateJournal()
+{
+    close();
+}
+
+juce::File StateJournal::getDefaultJournalFolder()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+               .getChildFile("CinemixAutomationBridge")
+               .getChildFile("Journal");
+}
+
+juce::File StateJournal::getJournalFile(const juce::String& journalId)
+{
+    return getDefaultJournalFolder().getChildFile(journalId + ".journal");
+}
+
+//==============================================================================
+// Ownership
+
+bool StateJournal::claimId(const juce::String& journalId)
+{
+    const juce::ScopedLock sl(getClaimedIdLock());
+
+    if (getClaimedIds().contains(journalId))
+        return false;
+
+    getClaimedIds().add(journalId);
+    return true;
+}
+
+void StateJournal::releaseId(const juce::String& journalId)
+{
+    const juce::ScopedLock sl(getClaimedIdLock());
+    getClaimedIds().removeString(journalId);
+}
+
+//==============================================================================
+// Open / Close
+
+bool StateJournal::open(const juce::String& newJournalId, const Values& currentValues, bool consoleActive,
+                        RecoveredState* recovered)
+{
+    if (newJournalId == journalId)
+        return isOpen();
+
+    // IDs come from saved sessions and name a file: only ever a UUID
+    if (newJournalId.isEmpty() || !newJournalId.containsOnly("0123456789abcdefABCDEF-"))
+        return false;
+
+    if (!claimId(newJournalId))
+        return false;
+
+    auto newLock = std::make_unique<juce::InterProcessLock>(getLockName(newJournalId));
+
+    if (!newLock->enter(0))
+    {
+        releaseId(newJournalId);
+        return false;
+    }
+
+    auto file = getJournalFile(newJournalId);
+    RecoveredState found;
+    readJournal(file, found);
+
+    // Start the file from scratch, then lay the region out in place
+    auto newMapping = std::make_unique<Mapping>();
+    file.deleteFile();
+
+    if (file.getParentDirectory().createDirectory().wasOk())
+    {
+        juce::FileOutputStream stream(file);
+
+        if (!stream.failedToOpen() && stream.writeRepeatedByte(0, sizeof(Region)))
+        {
+            stream.flush();
+        }
+    }
+
+    if (file.getSize() == (juce::int64) sizeof(Region))
+    {
+        newMapping->file = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readWrite, false);
+
+        if (newMapping->file->getData() != nullptr && newMapping->file->getSize() >= sizeof(Region))
+            newMapping->region = new (newMapping->file->getData()) Region();
+    }
+
+    if (newMapping->region == nullptr)
+    {
+        newMapping.reset();
+        file.deleteFile();
+        newLock->exit();
+        releaseId(newJournalId);
+        return false;
+    }
+
+    // Only now is it safe to let go of the journal that was open
+    close();
+
+    newMapping->region->header.regionSize = (juce::uint32) sizeof(Region);
+
+    journalId = newJournalId;
+    journalFile = file;
+    processLock = std::move(newLock);
+    nextSequence = 1;
+    checkpointSequence = 0;
+    latestCheckpoint = 1;
+
+    mapping.update(std::move(newMapping));
+
+    // The recovered state is where this run carries on from
+    if (found.isValid)
+        checkpoint(found.values, found.consoleActive);
+    else
+        checkpoint(currentValues, consoleActive);
+
+    mapping.read()->region->header.magic = magicNumber;
+
+    if (recovered != nullptr)
+        *recovered = found;
+
+    removeStaleJournals();
+    return true;
+}
+
+void StateJournal::close()
+{
+    if (!isOpen())
+        return;
+
+    // Returns once no append can still be writing to the mapping
+    mapping.update(nullptr);
+    journalFile.deleteFile();
+
+    processLock->exit();
+    processLock.reset();
+    releaseId(journalId);
+
+    journalId = {};
+    journalFile = {};
+}
+
+void StateJournal::removeStaleJournals()
+{
+    // Left by sessions that crashed and were never opened again
+    auto now = juce::Time::getCurrentTime();
+
+    for (const auto& file : getDefaultJournalFolder().findChildFiles(juce::File::findFiles, false, "*.journal"))
+    {
+        if ((now - file.getLastModificationTime()).inMilliseconds() < staleJournalAgeMs)
+            continue;
+
+        auto staleId = file.getFileNameWithoutExtension();
+
+        if (!claimId(staleId))
+            continue;
+
+        juce::InterProcessLock lock(getLockName(staleId));
+
+        if (lock.enter(0))
+        {
+            file.deleteFile();
+            lock.exit();
+        }
+
+        releaseId(staleId);
+    }
+}
+
+//==============================================================================
+// Writing
+
+void StateJournal::append(int paramIndex, float value) noexcept
+{
+    if (!juce::isPositiveAndBelow(paramIndex, numParameters))
+        return;
+
+    auto current = mapping.read();
+
+    if (!current)
+        return;
+
+    auto sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+    auto record = (sequence << sequenceShift) | ((juce::uint64) paramIndex << 16) | toRecordValue(value);
+
+    current->region->records[(size_t) (sequence % ringCapacity)].store(record, std::memory_order_release);
+}
+
+bool StateJournal::needsCheckpoint() const noexcept
+{
+    if (!isOpen())
+        return false;
+
+    auto pending = nextSequence.load(std::memory_order_relaxed) - 1 - checkpointSequence;
+    auto sinceLastMs = juce::Time::getMillisecondCounter() - lastCheckpointMs;
+
+    return pending >= (juce::uint64) ringCapacity / 4
+        || (pending > 0 && sinceLastMs >= (juce::uint32) checkpointIntervalMs)
+        || sinceLastMs >= (juce::uint32) refreshIntervalMs;
+}
+
+void StateJournal::checkpoint(const Values& values, bool consoleActive)
+{
+    auto current = mapping.read();
+
+    if (!current)
+        return;
+
+    // Every record before this one is covered by the values
+    auto firstUncovered = nextSequence.load(std::memory_order_acquire);
+
+    // Overwrite the older slot; the newer one stays valid until this one is
+    auto slotIndex = 1 - latestCheckpoint;
+    auto& slot = current->region->checkpoints[(size_t) slotIndex];
+
+    slot.sequence.store(0, std::memory_order_release);
+    slot.consoleActive = consoleActive ? 1 : 0;
+    slot.timeMs = juce::Time::currentTimeMillis();
+
+    for (int i = 0; i < numParameters; ++i)
+        slot.values[(size_t) i] = toRecordValue(values[(size_t) i]);
+
+    slot.sequence.store(firstUncovered, std::memory_order_release);
+
+    latestCheckpoint = slotIndex;
+    checkpointSequence = firstUncovered - 1;
+    lastCheckpointMs = juce::Time::getMillisecondCounter();
+}
+
+//==============================================================================
+// Recovery
+
+bool StateJournal::readJournal(const juce::File& file, RecoveredState& state)
+{
+    if (file.getSize() != (juce::int64) sizeof(Region))
+        return false;
+
+    juce::MemoryMappedFile mappedFile(file, juce::MemoryMappedFile::readOnly);
+
+    if (mappedFile.getData() == nullptr || mappedFile.getSize() < sizeof(Region))
+        return false;
+
+    const auto& region = *static_cast<const Region*>(mappedFile.getData());
+
+    if (region.header.magic.load() != magicNumber
+        || region.header.version != layoutVersion
+        || region.header.regionSize != (juce::uint32) sizeof(Region)
+        || region.header.numParameters != (juce::uint32) numParameters)
+        return false;
+
+    // The newest complete checkpoint
+    const Checkpoint* latest = nullptr;
+
+    for (const auto& slot : region.checkpoints)
+        if (slot.sequence.load() != 0 && (latest == nullptr || slot.sequence.load() > latest->sequence.load()))
+            latest = &slot;
+
+    if (latest == nullptr)
+        return false;
+
+    auto firstUncovered = latest->sequence.load();
+
+    for (int i = 0; i < numParameters; ++i)
+        state.values[(size_t) i] = fromRecordValue(latest->values[(size_t) i]);
+
+    state.consoleActive = latest->consoleActive != 0;
+    state.checkpointTimeMs = latest->timeMs;
+
+    // The records after it, in the order they were appended (the sequence
+    // number is in the top bits, so sorting the records sorts by sequence)
+    std::vector<juce::uint64> records;
+    records.reserve((size_t) ringCapacity);
+
+    for (const auto& slot : region.records)
+    {
+        auto record = slot.load();
+
+        if ((record >> sequenceShift) >= firstUncovered)
+            records.push_back(record);
+    }
+
+    std::sort(records.begin(), records.end());
+
+    auto expected = firstUncovered;
+
+    for (auto record : records)
+    {
+        auto sequence = record >> sequenceShift;
+        auto paramIndex = (int) ((record >> 16) & 0xFF);
+
+        // Gaps: overwritten by a full ring, or reserved but never written
+        state.numChangesLost += (int) (sequence - expected);
+        expected = sequence + 1;
+
+        if (paramIndex < numParameters)
+        {
+            state.values[(size_t) paramIndex] = fromRecordValue((juce::uint16) (record & 0xFFFF));
+            ++state.numChangesReplayed;
+        }
+    }
+
+    state.isValid = true;
+    return true;
+}
@@ -0,0 +1,184 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - StateJournal.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include "ConsoleLayout.h"
+#include "RcuPointer.h"
+
+//==============================================================================
+/**
+ * StateJournal
+ *
+ * Append-only record of every parameter change, in a memory-mapped file,
+ * so the mix survives a host crash between session saves.
+ *
+ * Each change is one 64-bit record (sequence number, parameter, 16-bit
+ * value) written with a single atomic store into a ring in the mapping -
+ * wait-free from any thread, with no syscalls. The operating system writes
+ * the pages back, so they outlive the process even if it's killed. Every
+ * few seconds, or when a quarter of the ring has been written since the
+ * last one, a checkpoint of all values goes into one of two alternating
+ * slots; the slot's sequence number is stored last, so a checkpoint torn
+ * by a crash is never used.
+ *
+ * Recovery takes the newest complete checkpoint and replays the records
+ * after it, which is a few hundred kilobytes of memory reads at most.
+ *
+ * A journal is named after an ID kept in the plugin state. A clean close
+ * deletes the file, so a journal still there when its session is loaded
+ * again means the last run didn't end cleanly. An ID is held by one
+ * instance at a time (across processes too), so a duplicated track doesn't
+ * pick up, or overwrite, the original's journal.
+ */
+class StateJournal
+{
+public:
+    //==============================================================================
+    using Layout = CinemixConsole;
+
+    static constexpr int numParameters = Layout::totalParameters;
+    static constexpr int ringCapacity = 1 << 14;
+    static constexpr int checkpointIntervalMs = 5000;
+    static constexpr int refreshIntervalMs = 60000;    // Checkpoints even without changes, to date the journal
+
+    using Values = std::array<float, numParameters>;
+
+    /** The state found in a journal left behind by a crash */
+    struct RecoveredState
+    {
+        bool isValid = false;
+        Values values {};
+        bool consoleActive = false;         // The console was driven when the checkpoint was taken
+        juce::int64 checkpointTimeMs = 0;   // When that was, on the wall clock (Time::currentTimeMillis())
+        int numChangesReplayed = 0;         // Records applied on top of the checkpoint
+        int numChangesLost = 0;             // Overwritten in the ring before a checkpoint
+    };
+
+    //==============================================================================
+    StateJournal();
+
+    /** Closes the journal cleanly (deleting its file) */
+    ~StateJournal();
+
+    /** Where the journals are kept */
+    static juce::File getDefaultJournalFolder();
+
+    /**
+     * Starts journalling under the given ID, beginning from these values.
+     *
+     * If a journal with this ID was left behind by a crash, its latest state
+     * is read into recovered (when given) first, and becomes the starting
+     * point instead. Fails, leaving any open journal as it was, if another
+     * instance holds the ID or the file can't be created. On success, the
+     * journal open before is closed cleanly.
+     */
+    bool open(const juce::String& journalId, const Values& currentValues, bool consoleActive,
+              RecoveredState* recovered = nullptr);
+
+    /** Stops journalling and deletes the file, since nothing needs recovering */
+    void close();
+
+    bool isOpen() const noexcept                    { return journalId.isNotEmpty(); }
+    const juce::String& getJournalId() const noexcept { return journalId; }
+
+    //==============================================================================
+    /** Records a change (wait-free, any thread); does nothing while closed */
+    void append(int paramIndex, float value) noexcept;
+
+    /**
+     * True once enough has been appended, or enough time passed, for a
+     * checkpoint; and at least every refreshIntervalMs, so a recovered
+     * checkpoint's time says when the session was last running.
+     */
+    bool needsCheckpoint() const noexcept;
+
+    /**
+     * Writes every value as the new starting point for recovery. Call from
+     * one thread at a time (the message thread), with values at least as new
+     * as every append so far.
+     */
+    void checkpoint(const Values& values, bool consoleActive);
+
+private:
+    //==============================================================================
+    static constexpr juce::uint32 magicNumber = 0x4a786d43;   // "CmxJ"
+    static constexpr juce::uint32 layoutVersion = 2;
+
+    // A record: sequence number << 24 | parameter << 16 | 16-bit value.
+    // Sequence numbers start at 1, so an empty slot (0) is never replayed
+    static constexpr int sequenceShift = 24;
+    static_assert(numParameters <= 256, "Journal records hold an 8-bit parameter index");
+
+    struct Header
+    {
+        std::atomic<juce::uint32> magic { 0 };
+        juce::uint32 version = layoutVersion;
+        juce::uint32 regionSize = 0;
+        juce::uint32 numParameters = StateJournal::numParameters;
+    };
+
+    struct Checkpoint
+    {
+        std::atomic<juce::uint64> sequence { 0 };           // Last record included; 0 while being written
+        juce::uint32 consoleActive = 0;
+        juce::int64 timeMs = 0;                             // Wall clock
+        std::array<juce::uint16, numParameters> values {};
+    };
+
+    struct Region
+    {
+        Header header;
+        std::array<Checkpoint, 2> checkpoints;
+        std::array<std::atomic<juce::uint64>, ringCapacity> records;
+    };
+
+    static_assert(std::atomic<juce::uint64>::is_always_lock_free, "Journal records are lock-free 64-bit stores");
+
+    struct Mapping
+    {
+        std::unique_ptr<juce::MemoryMappedFile> file;
+        Region* region = nullptr;
+    };
+
+    //==============================================================================
+    juce::String journalId;
+    juce::File journalFile;
+    std::unique_ptr<juce::InterProcessLock> processLock;
+
+    // Published to append(); close() waits for appends in progress to finish
+    RcuPointer<Mapping> mapping;
+
+    std::atomic<juce::uint64> nextSequence { 1 };
+    juce::uint64 checkpointSequence = 0;
+    juce::uint32 lastCheckpointMs = 0;
+    int latestCheckpoint = 0;
+
+    static juce::File getJournalFile(const juce::String& journalId);
+
+    static bool claimId(const juce::String& journalId);
+    static void releaseId(const juce::String& journalId);
+
+    static bool readJournal(const juce::File& file, RecoveredState& state);
+    static void removeStaleJournals();
+
+    static juce::uint16 toRecordValue(float value) noexcept  { return (juce::uint16) juce::roundToInt(juce::jlimit(0.0f, 1.0f, value) * 65535.0f); }
+    static float fromRecordValue(juce::uint16 value) noexcept { return (float) value / 65535.0f; }
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (StateJournal)
+};
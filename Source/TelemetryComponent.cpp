@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - TelemetryComponent.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "TelemetryComponent.h"
+
+//==============================================================================
+TelemetryComponent::TelemetryComponent(Source snapshotSource, int ledSpacing)
+    : source(std::move(snapshotSource)),
+      stripSpacing(ledSpacing)
+{
+    source(previous);
+    startTimerHz(refreshRateHz);
+}
+
+TelemetryComponent::~TelemetryComponent()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void TelemetryComponent::paint(juce::Graphics& g)
+{
+    g.fillAll(juce::Colour(0xff1a1a1a));
+
+    // One LED per strip, then a gap and the master section's
+    constexpr int ledSize = 8;
+
+    for (int strip = 0; strip < BridgeTelemetry::numStrips; ++strip)
+    {
+        int x = strip * stripSpacing + (stripSpacing - ledSize) / 2;
+
+        if (strip == CinemixConsole::numChannels)
+            x += stripSpacing / 2;
+
+        auto level = ledLevels[(size_t) strip];
+        g.setColour(juce::Colours::darkgreen.darker().interpolatedWith(juce::Colours::limegreen, level));
+        g.fillEllipse((float) x, 3.0f, (float) ledSize, (float) ledSize);
+    }
+
+    g.setColour(juce::Colours::lightgrey);
+    g.setFont(11.0f);
+
+    auto textArea = getLocalBounds().withTrimmedTop(14).reduced(2, 0);
+
+    for (const auto& line : rateLines)
+        g.drawText(line, textArea.removeFromTop(14), juce::Justification::centredLeft, true);
+}
+
+void TelemetryComponent::timerCallback()
+{
+    Snapshot current;
+    source(current);
+
+    // Lit by any message since the last look, fading over a few frames
+    for (size_t strip = 0; strip < (size_t) BridgeTelemetry::numStrips; ++strip)
+        ledLevels[strip] = current.stripMessages[strip] != previous.stripMessages[strip] ? 1.0f : ledLevels[strip] * 0.6f;
+
+    auto elapsedSeconds = juce::jmax(0.001, (current.timeMs - previous.timeMs) / 1000.0);
+
+    auto rate = [elapsedSeconds](juce::uint64 now, juce::uint64 before)
+    {
+        return juce::String(juce::roundToInt((double) (now - before) / elapsedSeconds));
+    };
+
+    rateLines.clearQuick();
+
+    for (size_t port = 0; port < (size_t) BridgeTelemetry::numPorts; ++port)
+    {
+        const auto& now = current.ports[port];
+        const auto& before = previous.ports[port];
+        juce::String line;
+
+        line << "Port " << (int) port + 1
+             << "   out " << rate(now.messagesSent, before.messagesSent) << " msg/s, "
+             << rate(now.bytesSent, before.bytesSent) << " B/s"
+             << "   in " << rate(now.messagesReceived, before.messagesReceived) << " msg/s, "
+             << rate(now.bytesReceived, before.bytesReceived) << " B/s"
+             << "   queue " << current.queues[port].depth << " (max " << current.queues[port].highWater << ")";
+
+        rateLines.add(line);
+    }
+
+    rateLines.add("Deduplicated " + rate(current.deduplicatedSends, previous.deduplicatedSends) + "/s"
+                  + "   echoes suppressed " + rate(current.suppressedEchoes, previous.suppressedEchoes) + "/s"
+                  + "   decode misses " + rate(current.decodeMisses, previous.decodeMisses) + "/s");
+
+    previous = current;
+    repaint();
+}
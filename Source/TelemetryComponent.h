@@ -0,0 +1,68 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - TelemetryComponent.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include <functional>
+#include "BridgeTelemetry.h"
+
+//==============================================================================
+/**
+ * TelemetryComponent
+ *
+ * A compact view of a router's telemetry: one activity LED per console
+ * strip (laid out to sit under ConsoleViewComponent's strips, the master
+ * section last), then a line per port - messages and bytes per second each
+ * way, queue depth and high-water mark - and one with the deduplicated
+ * sends, suppressed echoes and decode misses per second.
+ *
+ * A timer reads a snapshot through the source function and works out the
+ * rates from the previous one; nothing is locked and nothing is counted
+ * while the editor is closed, since the counters run either way.
+ */
+class TelemetryComponent : public juce::Component,
+                           private juce::Timer
+{
+public:
+    //==============================================================================
+    using Source = std::function<void(BridgeTelemetry::Snapshot&)>;
+
+    static constexpr int refreshRateHz = 10;
+    static constexpr int preferredHeight = 56;
+
+    /** ledSpacing should match the strips the LEDs sit under */
+    TelemetryComponent(Source snapshotSource, int ledSpacing);
+    ~TelemetryComponent() override;
+
+    //==============================================================================
+    void paint(juce::Graphics& g) override;
+
+private:
+    //==============================================================================
+    using Snapshot = BridgeTelemetry::Snapshot;
+
+    Source source;
+    const int stripSpacing;
+
+    Snapshot previous;
+    std::array<float, BridgeTelemetry::numStrips> ledLevels {};
+    juce::StringArray rateLines;
+
+    void timerCallback() override;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TelemetryComponent)
+};
@@ -0,0 +1,188 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - TelemetryLogger.cpp
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#include "TelemetryLogger.h"
+
+//==============================================================================
+TelemetryLogger::TelemetryLogger(Source snapshotSource)
+    : juce::Thread("Cinemix Telemetry Log"),
+      source(std::move(snapshotSource))
+{
+}
+
+TelemetryLogger::~TelemetryLogger()
+{
+    stop();
+}
+
+juce::File TelemetryLogger::getDefaultLogFolder()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+               .getChildFile("CinemixAutomationBridge")
+               .getChildFile("Telemetry");
+}
+
+void TelemetryLogger::start()
+{
+    if (isThreadRunning())
+        return;
+
+    {
+        const juce::ScopedLock sl(fileLock);
+        auto now = juce::Time::getCurrentTime();
+        logFile = getDefaultLogFolder()
+                      .getChildFile("Telemetry_" + now.formatted("%Y-%m-%d_%H-%M-%S") + ".csv")
+                      .getNonexistentSibling();
+    }
+
+    startThread(juce::Thread::Priority::low);
+}
+
+void TelemetryLogger::stop()
+{
+    if (!isThreadRunning())
+        return;
+
+    signalThreadShouldExit();
+    notify();
+    stopThread(2000);
+}
+
+juce::File TelemetryLogger::getLogFile() const
+{
+    const juce::ScopedLock sl(fileLock);
+    return logFile;
+}
+
+//==============================================================================
+// Logging Thread
+
+void TelemetryLogger::run()
+{
+    if (!openLogFile())
+        return;
+
+    Snapshot previous, current;
+    source(previous);
+
+    while (!threadShouldExit())
+    {
+        wait(intervalMs);
+
+        source(current);
+        writeLine(previous, current);
+        previous = current;
+
+        if (output->getPosition() >= maxFileBytes)
+            rollOver();
+
+        if (output == nullptr)
+            return;
+    }
+
+    output.reset();
+}
+
+bool TelemetryLogger::openLogFile()
+{
+    auto file = getLogFile();
+
+    if (file.getParentDirectory().createDirectory().failed())
+        return false;
+
+    output = std::make_unique<juce::FileOutputStream>(file);
+    if (output->failedToOpen())
+    {
+        output.reset();
+        return false;
+    }
+
+    // A new file (or one just emptied by rollOver()) starts with the column names
+    output->setPosition(0);
+    output->truncate();
+    output->writeText(createHeaderLine(), false, false, "\n");
+    output->flush();
+    return true;
+}
+
+void TelemetryLogger::rollOver()
+{
+    output.reset();
+
+    auto file = getLogFile();
+    auto previousFile = file.getSiblingFile(file.getFileNameWithoutExtension() + ".previous.csv");
+
+    previousFile.deleteFile();
+    file.moveFileTo(previousFile);
+
+    openLogFile();
+}
+
+juce::String TelemetryLogger::createHeaderLine()
+{
+    juce::StringArray columns { "time", "elapsed_s" };
+
+    for (int port = 1; port <= BridgeTelemetry::numPorts; ++port)
+        for (auto* name : { "sent_msgs_per_s", "sent_bytes_per_s", "received_msgs_per_s",
+                            "received_bytes_per_s", "queue_depth", "queue_high_water" })
+            columns.add("port" + juce::String(port) + "_" + name);
+
+    columns.add("deduplicated_per_s");
+    columns.add("suppressed_echoes_per_s");
+    columns.add("decode_misses_per_s");
+
+    for (int strip = 0; strip < CinemixConsole::numChannels; ++strip)
+        columns.add("ch" + juce::String(strip + 1) + "_msgs");
+
+    columns.add("master_msgs");
+    return columns.joinIntoString(",") + "\n";
+}
+
+void TelemetryLogger::writeLine(const Snapshot& previous, const Snapshot& current)
+{
+    auto elapsedSeconds = juce::jmax(0.001, (current.timeMs - previous.timeMs) / 1000.0);
+
+    auto rate = [elapsedSeconds](juce::uint64 now, juce::uint64 before)
+    {
+        return juce::String((double) (now - before) / elapsedSeconds, 1);
+    };
+
+    juce::StringArray fields;
+    fields.add(juce::Time::getCurrentTime().toISO8601(true));
+    fields.add(juce::String(elapsedSeconds, 3));
+
+    for (size_t port = 0; port < (size_t) BridgeTelemetry::numPorts; ++port)
+    {
+        const auto& now = current.ports[port];
+        const auto& before = previous.ports[port];
+
+        fields.add(rate(now.messagesSent, before.messagesSent));
+        fields.add(rate(now.bytesSent, before.bytesSent));
+        fields.add(rate(now.messagesReceived, before.messagesReceived));
+        fields.add(rate(now.bytesReceived, before.bytesReceived));
+        fields.add(juce::String(current.queues[port].depth));
+        fields.add(juce::String(current.queues[port].highWater));
+    }
+
+    fields.add(rate(current.deduplicatedSends, previous.deduplicatedSends));
+    fields.add(rate(current.suppressedEchoes, previous.suppressedEchoes));
+    fields.add(rate(current.decodeMisses, previous.decodeMisses));
+
+    // Messages in the interval, so a busy strip stands out
+    for (size_t strip = 0; strip < (size_t) BridgeTelemetry::numStrips; ++strip)
+        fields.add(juce::String(current.stripMessages[strip] - previous.stripMessages[strip]));
+
+    output->writeText(fields.joinIntoString(",") + "\n", false, false, "\n");
+    output->flush();
+}
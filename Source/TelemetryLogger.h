@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    CinemixAutomationBridge - TelemetryLogger.h
+    JUCE-based replication of D&R Cinemix VST Automation Bridge
+
+    Copyright (c) 2012 Guido Scognamiglio (original VST 2.4 version)
+    Copyright (c) 2026 (JUCE 8.0.12 replication)
+
+    MIT License - See LICENSE file for details
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <functional>
+#include "BridgeTelemetry.h"
+
+//==============================================================================
+/**
+ * TelemetryLogger
+ *
+ * Writes a router's telemetry to a CSV file once a second from a
+ * low-priority thread: per-second rates for every counter, the queue depth
+ * and high-water mark of each port, and the messages per console strip.
+ * Counters are read through the source function, which must be lock-free
+ * (see MidiRouter::getTelemetrySnapshot), so logging never holds up the
+ * audio or MIDI threads.
+ *
+ * Each run gets its own file, named after its start time. The file rolls
+ * over at maxFileBytes: the full one is kept as ".previous.csv" (replacing
+ * an older one) and a fresh file is started, so a run never takes more than
+ * twice that on disk.
+ */
+class TelemetryLogger : private juce::Thread
+{
+public:
+    //==============================================================================
+    using Source = std::function<void(BridgeTelemetry::Snapshot&)>;
+
+    static constexpr int intervalMs = 1000;
+    static constexpr juce::int64 maxFileBytes = 4 * 1024 * 1024;
+
+    explicit TelemetryLogger(Source snapshotSource);
+    ~TelemetryLogger() override;
+
+    /** Returns the folder log files are written to */
+    static juce::File getDefaultLogFolder();
+
+    /** Starts a new log file and the logging thread */
+    void start();
+
+    /** Stops logging; the file is complete when this returns */
+    void stop();
+
+    bool isLogging() const      { return isThreadRunning(); }
+
+    /** The file being written (valid once start() has been called) */
+    juce::File getLogFile() const;
+
+private:
+    //==============================================================================
+    using Snapshot = BridgeTelemetry::Snapshot;
+
+    Source source;
+
+    // Written on start(), read by the logging thread
+    juce::File logFile;
+    mutable juce::CriticalSection fileLock;
+
+    // Logging thread only
+    std::unique_ptr<juce::FileOutputStream> output;
+
+    void run() override;
+    bool openLogFile();
+    void rollOver();
+    void writeLine(const Snapshot& previous, const Snapshot& current);
+
+    static juce::String createHeaderLine();
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TelemetryLogger)
+};